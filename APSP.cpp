@@ -0,0 +1,193 @@
+#include "APSP.hpp"
+#include "CsrGraph.hpp"
+#include "MinHeap.hpp"
+#include "Parallel.hpp"
+#include <algorithm>
+#include <atomic>
+#include <climits>
+#include <exception>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace st = std;
+
+namespace graph {
+
+// ---------------------------------------------------------------------------
+// DistanceMatrix
+// ---------------------------------------------------------------------------
+
+static st::size_t matrixBytes(int n) {
+    if (n < 0)
+        throw st::invalid_argument("DistanceMatrix: negative size");
+    return static_cast<st::size_t>(n) * static_cast<st::size_t>(n) * sizeof(int);
+}
+
+DistanceMatrix::DistanceMatrix(int n)
+    : n_(n), data_(nullptr), bytes_(matrixBytes(n)), mapped_(false) {
+    data_ = new int[static_cast<st::size_t>(n) * n];
+}
+
+DistanceMatrix::DistanceMatrix(int n, const st::string& path)
+    : n_(n), data_(nullptr), bytes_(matrixBytes(n)), mapped_(true) {
+#if defined(_WIN32)
+    (void)path;
+    throw st::runtime_error("DistanceMatrix: memory-mapped storage is not supported on this platform");
+#else
+    int fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0)
+        throw st::runtime_error("DistanceMatrix: cannot open " + path);
+    if (bytes_ == 0) {
+        ::close(fd);
+        return;
+    }
+    if (::ftruncate(fd, static_cast<off_t>(bytes_)) != 0) {
+        ::close(fd);
+        throw st::runtime_error("DistanceMatrix: cannot resize " + path);
+    }
+    void* p = ::mmap(nullptr, bytes_, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (p == MAP_FAILED)
+        throw st::runtime_error("DistanceMatrix: cannot map " + path);
+    data_ = static_cast<int*>(p);
+#endif
+}
+
+DistanceMatrix::~DistanceMatrix() {
+    if (!data_) return;
+#if !defined(_WIN32)
+    if (mapped_) {
+        ::munmap(data_, bytes_);
+        return;
+    }
+#endif
+    delete[] data_;
+}
+
+DistanceMatrix::DistanceMatrix(DistanceMatrix&& other) noexcept
+    : n_(other.n_), data_(other.data_), bytes_(other.bytes_), mapped_(other.mapped_) {
+    other.n_ = 0;
+    other.data_ = nullptr;
+    other.bytes_ = 0;
+}
+
+DistanceMatrix& DistanceMatrix::operator=(DistanceMatrix&& other) noexcept {
+    if (this != &other) {
+        DistanceMatrix old(st::move(*this));
+        n_ = other.n_;
+        data_ = other.data_;
+        bytes_ = other.bytes_;
+        mapped_ = other.mapped_;
+        other.n_ = 0;
+        other.data_ = nullptr;
+        other.bytes_ = 0;
+    }
+    return *this;
+}
+
+void DistanceMatrix::sync() {
+#if !defined(_WIN32)
+    if (mapped_ && data_ && ::msync(data_, bytes_, MS_SYNC) != 0)
+        throw st::runtime_error("DistanceMatrix: msync failed");
+#endif
+}
+
+// ---------------------------------------------------------------------------
+// Parallel APSP
+// ---------------------------------------------------------------------------
+
+// Heap entry for lazy-deletion Dijkstra: stale entries are skipped on extract.
+struct QueueEntry {
+    int dist;
+    int vertex;
+};
+
+struct QueueEntryCompare {
+    bool operator()(const QueueEntry& a, const QueueEntry& b) const {
+        return a.dist < b.dist;
+    }
+};
+
+using EntryMinHeap = MinHeap<QueueEntry, QueueEntryCompare>;
+
+// Single-source Dijkstra over the CSR snapshot, writing into dist[0..n).
+// The heap is drained on return, so workers reuse it across sources.
+static void dijkstraRow(const CsrGraph& csr, int source, int* dist, EntryMinHeap& heap) {
+    st::fill(dist, dist + csr.numVertices, INT_MAX);
+    dist[source] = 0;
+    heap.insert({0, source});
+    while (!heap.isEmpty()) {
+        QueueEntry top = heap.extractMin();
+        int u = top.vertex;
+        if (top.dist > dist[u]) continue;
+        for (int i = csr.offsets[u]; i < csr.offsets[u + 1]; ++i) {
+            int v = csr.dests[i];
+            long long alt = static_cast<long long>(top.dist) + csr.weights[i];
+            if (alt < dist[v]) {
+                dist[v] = static_cast<int>(alt);
+                heap.insert({dist[v], v});
+            }
+        }
+    }
+}
+
+void allPairsShortestPaths(const Graph& g, DistanceMatrix& out,
+                           int numThreads, const ApspProgress& progress) {
+    int n = g.numVertices;
+    if (out.size() != n)
+        throw st::invalid_argument("allPairsShortestPaths: matrix size does not match graph");
+    if (numThreads < 0)
+        throw st::invalid_argument("allPairsShortestPaths: negative thread count");
+    if (n == 0) return;
+
+    numThreads = st::min(resolveThreadCount(numThreads), n);
+
+    CsrGraph csr(g);
+    st::atomic<int>  nextSource(0);
+    st::atomic<int>  finished(0);
+    st::atomic<bool> failed(false);
+    st::mutex          reportMutex;
+    st::exception_ptr  error;
+    const int step = st::max(1, n / 100);
+
+    auto worker = [&]() {
+        try {
+            EntryMinHeap heap;  // thread-private workspace
+            for (;;) {
+                if (failed.load(st::memory_order_relaxed)) return;
+                int s = nextSource.fetch_add(1, st::memory_order_relaxed);
+                if (s >= n) return;
+                dijkstraRow(csr, s, out.row(s), heap);
+                int done = finished.fetch_add(1, st::memory_order_relaxed) + 1;
+                if (progress && (done % step == 0 || done == n)) {
+                    st::lock_guard<st::mutex> lock(reportMutex);
+                    progress(done, n);
+                }
+            }
+        } catch (...) {
+            st::lock_guard<st::mutex> lock(reportMutex);
+            if (!error) error = st::current_exception();
+            failed = true;
+        }
+    };
+
+    st::vector<st::thread> pool;
+    pool.reserve(numThreads - 1);
+    for (int t = 1; t < numThreads; ++t)
+        pool.emplace_back(worker);
+    worker();
+    for (st::thread& th : pool)
+        th.join();
+
+    if (error) st::rethrow_exception(error);
+}
+
+}
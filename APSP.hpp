@@ -0,0 +1,65 @@
+#pragma once
+#include "graph.hpp"
+#include <cstddef>
+#include <functional>
+#include <string>
+
+namespace graph {
+
+/// @brief Row-major n x n matrix of shortest-path distances.
+/// Entry (i, j) is the distance from i to j, or INT_MAX if j is unreachable.
+/// Storage is either heap memory or a file mapped with mmap (MAP_SHARED),
+/// so matrices larger than RAM can be paged out to disk.
+class DistanceMatrix {
+private:
+    int         n_;
+    int*        data_;
+    std::size_t bytes_;
+    bool        mapped_;
+
+public:
+    /// @brief Allocate an in-memory n x n matrix.
+    /// @throws std::invalid_argument if n < 0.
+    explicit DistanceMatrix(int n);
+
+    /// @brief Create (or truncate) the file at path and map an n x n matrix onto it.
+    /// @throws std::invalid_argument if n < 0.
+    /// @throws std::runtime_error if the file cannot be created or mapped.
+    DistanceMatrix(int n, const std::string& path);
+
+    ~DistanceMatrix();
+
+    DistanceMatrix(const DistanceMatrix&) = delete;
+    DistanceMatrix& operator=(const DistanceMatrix&) = delete;
+    DistanceMatrix(DistanceMatrix&& other) noexcept;
+    DistanceMatrix& operator=(DistanceMatrix&& other) noexcept;
+
+    int size() const { return n_; }
+    bool isMapped() const { return mapped_; }
+
+    int*       row(int i)       { return data_ + static_cast<std::size_t>(i) * n_; }
+    const int* row(int i) const { return data_ + static_cast<std::size_t>(i) * n_; }
+    int at(int i, int j) const  { return row(i)[j]; }
+
+    /// @brief Flush a file-backed matrix to disk (no-op for heap storage).
+    void sync();
+};
+
+/// @brief Progress callback: (sources finished, total sources).
+/// Calls are serialized but may come from any worker thread.
+using ApspProgress = std::function<void(int, int)>;
+
+/// @brief All-pairs shortest paths: one Dijkstra per source, sources
+/// distributed dynamically over a pool of worker threads.
+/// Each worker owns its heap; row s of out is used directly as the distance
+/// array for source s, so no per-source result Graph is allocated.
+/// @param g          Graph with non-negative weights
+/// @param out        Preallocated matrix with out.size() == g.numVertices
+/// @param numThreads Worker count; 0 selects std::thread::hardware_concurrency()
+/// @param progress   Optional callback, invoked roughly every 1% of sources
+/// @throws std::invalid_argument if out has the wrong size or numThreads < 0.
+void allPairsShortestPaths(const Graph& g, DistanceMatrix& out,
+                           int numThreads = 0,
+                           const ApspProgress& progress = nullptr);
+
+}
@@ -0,0 +1,125 @@
+#pragma once
+#include "graph.hpp"
+#include "CsrGraph.hpp"
+#include "CompressedGraph.hpp"
+#include "StreamVByteGraph.hpp"
+#include "DynamicGraph.hpp"
+
+namespace graph {
+
+// Adjacency adapters give algorithm templates one cursor interface over the
+// out-arcs of a vertex, whatever the storage:
+//   Cursor first(u)        first arc of u
+//   bool   done(u, c)      c is past u's last arc
+//   Cursor next(c)         following arc of the same vertex
+//   int    dest(c)         head of the arc
+//   Weight weight(c)       weight of the arc (Adj::Weight)
+// Loops that never suspend a scan use forEachArc instead; formats with a
+// bulk decode path (StreamVByteAdjacency) overload it.
+
+/// @brief Linked adjacency lists of a Graph.
+struct ListAdjacency {
+    using Cursor = const Edge*;
+    using Weight = int;
+
+    const Graph& g;
+
+    int    numVertices() const { return g.numVertices; }
+    Cursor first(int u) const { return g.adjList[u]->edges; }
+    bool   done(int, Cursor c) const { return c == nullptr; }
+    Cursor next(Cursor c) const { return c->next; }
+    int    dest(Cursor c) const { return c->dest->data; }
+    int    weight(Cursor c) const { return c->weight; }
+};
+
+/// @brief CSR arrays (CsrGraph or a mapped graph file) with weights of type W.
+/// For NoWeight, weight() returns the empty tag without touching memory.
+template<typename W>
+struct BasicCsrAdjacency {
+    using Cursor = int;
+    using Weight = W;
+
+    BasicCsrView<W> csr;
+
+    int    numVertices() const { return csr.numVertices; }
+    Cursor first(int u) const { return csr.offsets[u]; }
+    bool   done(int u, Cursor c) const { return c == csr.offsets[u + 1]; }
+    Cursor next(Cursor c) const { return c + 1; }
+    int    dest(Cursor c) const { return csr.dests[c]; }
+    W      weight(Cursor c) const {
+        if constexpr (kHasWeights<W>) return csr.weights[c];
+        else { (void)c; return W{}; }
+    }
+};
+
+using CsrAdjacency = BasicCsrAdjacency<int>;
+
+/// @brief Delta + varint lists of a CompressedGraph, decoded as the cursor moves.
+struct CompressedAdjacency {
+    using Cursor = CompressedGraph::NeighborIterator;
+    using Weight = int;
+
+    const CompressedGraph& g;
+
+    int    numVertices() const { return g.numVertices(); }
+    Cursor first(int u) const { return g.neighbors(u).begin(); }
+    bool   done(int, const Cursor& c) const { return c.atEnd(); }
+    Cursor next(Cursor c) const { return ++c; }
+    int    dest(const Cursor& c) const { return c.dest(); }
+    int    weight(const Cursor& c) const { return c.weight(); }
+};
+
+/// @brief Tombstoned blocks of a DynamicGraph; the cursor steps over
+/// removed arcs. Callers hold g.readLock() while using it.
+struct DynamicAdjacency {
+    using Arc = DynamicGraph::Arc;
+    struct Cursor {
+        const Arc* at;
+        const Arc* end;
+    };
+    using Weight = int;
+
+    const DynamicGraph& g;
+
+    static Cursor skip(Cursor c) {
+        while (c.at != c.end && c.at->dest == DynamicGraph::kTombstone) ++c.at;
+        return c;
+    }
+
+    int    numVertices() const { return g.numVertices(); }
+    Cursor first(int u) const { return skip(Cursor{g.arcsBegin(u), g.arcsEnd(u)}); }
+    bool   done(int, Cursor c) const { return c.at == c.end; }
+    Cursor next(Cursor c) const { ++c.at; return skip(c); }
+    int    dest(Cursor c) const { return c.at->dest; }
+    int    weight(Cursor c) const { return c.at->weight; }
+};
+
+/// @brief Call fn(dest, weight) for every out-arc of u, in cursor order.
+template<typename Adj, typename Fn>
+inline void forEachArc(const Adj& g, int u, Fn&& fn) {
+    for (auto e = g.first(u); !g.done(u, e); e = g.next(e))
+        fn(g.dest(e), g.weight(e));
+}
+
+/// @brief Stream VByte blocks of a StreamVByteGraph. There is no per-arc
+/// cursor (so no DFS); forEachArc decodes a block of ids at a time.
+struct StreamVByteAdjacency {
+    using Weight = int;
+
+    const StreamVByteGraph& g;
+
+    int numVertices() const { return g.numVertices(); }
+};
+
+template<typename Fn>
+inline void forEachArc(const StreamVByteAdjacency& adj, int u, Fn&& fn) {
+    StreamVByteGraph::NeighborBlocks blocks = adj.g.blocks(u);
+    while (blocks.next()) {
+        const std::uint32_t* ids = blocks.ids();
+        const int* weights = blocks.weights();
+        for (int i = 0; i < blocks.size(); ++i)
+            fn(static_cast<int>(ids[i]), weights[i]);
+    }
+}
+
+}
@@ -2,13 +2,17 @@
 #include "Algorithms.hpp"
 #include "QForAlg.hpp"
 #include "MinHeap.hpp"
-#include "VertexMinHeap.hpp"
 #include "EdgeMinHeap.hpp"
+#include "IndexMinHeap.hpp"
+#include "Adjacency.hpp"
 #include <stdexcept>
 #include <iostream>
 #include <climits>
+#include <cstdint>
+#include <algorithm>
+#include <unordered_set>
+#include <vector>
 
-namespace vertexHeap = vertexheap;
 namespace edgeHeap = edgeheap;
 namespace qQueue = QForAlg;
 namespace st = std;
@@ -16,230 +20,487 @@ namespace gr = graph;
 
 namespace graph {
 
-    // BFS: builds directed BFS tree from source
-    // @param g      Graph to traverse (undirected or directed)
+    // bfsKernel: BFS tree from source as a parent array
+    // @param g      Adjacency adapter (see Adjacency.hpp)
     // @param source Start index of traversal (0-based)
-    // @return       New graph representing the BFS tree (directed)
-    Graph* bfs(const Graph& g, int source) {
-        int n = g.numVertices;
+    // @return       Directed tree; order is the BFS visiting order
+    template<typename Adj>
+    static BasicResultTree<typename Adj::Weight> bfsKernel(const Adj& g, int source) {
+        using W = typename Adj::Weight;
+        int n = g.numVertices();
         if (source < 0 || source >= n)
             throw st::out_of_range("bfs: source out of range");
 
-        Graph* result = new Graph(n);
-        qQueue::QForAlg queue(n);
+        BasicResultTree<W> tree(n, true);
+        qQueue::IntRingQueue queue(n);
         bool* visited = new bool[n]();
 
         // Mark the source and enqueue
         visited[source] = true;
-        queue.enqueue(g.adjList[source]);
+        queue.enqueue(source);
+        tree.order.push_back(source);
 
         // Process until queue is empty
         while (!queue.is_empty()) {
-            Vertex* u = queue.dequeue();
-            for (Edge* e = u->edges; e; e = e->next) {
-                int v = e->dest->data;
+            int u = queue.dequeue();
+            forEachArc(g, u, [&](int v, W w) {
+                (void)w;
                 if (!visited[v]) {
                     visited[v] = true;
-                    queue.enqueue(e->dest);
-                    // Add edge to BFS tree
-                    result->addDirectedEdge(u->data, v, e->weight);
+                    queue.enqueue(v);
+                    // Record tree edge u -> v
+                    tree.parent[v] = u;
+                    if constexpr (kHasWeights<W>) tree.weight[v] = w;
+                    tree.order.push_back(v);
                 }
-            }
+            });
         }
 
         delete[] visited;
-        return result;
-    }
-
-    // DFSVisit: recursive helper for DFS
-    // @param v   Current vertex in traversal
-    // @param vis Visited flag array
-    // @param res Result graph being built
-    static void DFSVisit(Vertex* v, bool* vis, Graph* res) {
-        vis[v->data] = true;
-        for (Edge* e = v->edges; e; e = e->next) {
-            if (!vis[e->dest->data]) {
-                // Add tree edge and recurse
-                res->addEdge(v->data, e->dest->data, e->weight);
-                DFSVisit(e->dest, vis, res);
+        return tree;
+    }
+
+    ResultTree bfsTree(const Graph& g, int source) {
+        return bfsKernel(ListAdjacency{g}, source);
+    }
+
+    template<typename W>
+    BasicResultTree<W> bfsTree(const BasicCsrView<W>& g, int source) {
+        return bfsKernel(BasicCsrAdjacency<W>{g}, source);
+    }
+
+    ResultTree bfsTree(const CompressedGraph& g, int source) {
+        return bfsKernel(CompressedAdjacency{g}, source);
+    }
+
+    ResultTree bfsTree(const DynamicGraph& g, int source) {
+        auto lock = g.readLock();
+        return bfsKernel(DynamicAdjacency{g}, source);
+    }
+
+    ResultTree bfsTree(const StreamVByteGraph& g, int source) {
+        return bfsKernel(StreamVByteAdjacency{g}, source);
+    }
+
+    // BFS: builds directed BFS tree from source
+    // @param g      Graph to traverse (undirected or directed)
+    // @param source Start index of traversal (0-based)
+    // @return       New graph representing the BFS tree (directed)
+    Graph* bfs(const Graph& g, int source) {
+        return bfsTree(g, source).toGraph();
+    }
+
+    // DFS stack entry: a vertex on the current path and its next arc to scan
+    template<typename Adj>
+    struct DfsFrame {
+        int                  vertex;
+        typename Adj::Cursor next;
+    };
+
+    // DFSVisit: iterative DFS from s; each stack entry is the next edge to
+    // scan for one vertex on the current path, so edges are taken in the same
+    // order a recursive DFS would take them.
+    // @param g     Adjacency adapter
+    // @param s     Root of this DFS tree
+    // @param vis   Visited flag array
+    // @param tree  Result being built
+    // @param stack Reused edge-cursor stack (empty on entry and exit)
+    template<typename Adj>
+    static void DFSVisit(const Adj& g, int s, bool* vis, BasicResultTree<typename Adj::Weight>& tree,
+                         st::vector<DfsFrame<Adj>>& stack) {
+        vis[s] = true;
+        tree.order.push_back(s);
+        stack.push_back({s, g.first(s)});
+        while (!stack.empty()) {
+            DfsFrame<Adj>& top = stack.back();
+            int u = top.vertex;
+            auto e = top.next;
+            if (g.done(u, e)) {
+                stack.pop_back();
+                continue;
             }
+            top.next = g.next(e);
+            int w = g.dest(e);
+            if (vis[w]) continue;
+            // Record tree edge and descend
+            vis[w] = true;
+            tree.parent[w] = u;
+            if constexpr (kHasWeights<typename Adj::Weight>) tree.weight[w] = g.weight(e);
+            tree.order.push_back(w);
+            stack.push_back({w, g.first(w)});
         }
     }
 
-    // DFS: builds DFS forest starting at source
-    // @param g      Graph to traverse (undirected or directed)
+    // dfsKernel: DFS forest starting at source as a parent array
+    // @param g      Adjacency adapter
     // @param source Start index for initial DFS (0-based)
-    // @return       New graph representing the DFS forest (tree edges)
-    Graph* dfs(const Graph& g, int source) {
-        int n = g.numVertices;
+    // @return       Undirected forest; order is the DFS preorder
+    template<typename Adj>
+    static BasicResultTree<typename Adj::Weight> dfsKernel(const Adj& g, int source) {
+        int n = g.numVertices();
         if (source < 0 || source >= n)
             throw st::out_of_range("dfs: source out of range");
 
-        Graph* result = new Graph(n);
+        BasicResultTree<typename Adj::Weight> tree(n, false);
         bool* visited = new bool[n]{};
+        st::vector<DfsFrame<Adj>> stack;
 
         // Start DFS from the given source
-        DFSVisit(g.adjList[source], visited, result);
+        DFSVisit(g, source, visited, tree, stack);
         // Continue DFS for any unvisited vertices
         for (int i = 0; i < n; ++i)
             if (!visited[i])
-                DFSVisit(g.adjList[i], visited, result);
+                DFSVisit(g, i, visited, tree, stack);
 
         delete[] visited;
-        return result;
+        return tree;
+    }
+
+    ResultTree dfsTree(const Graph& g, int source) {
+        return dfsKernel(ListAdjacency{g}, source);
+    }
+
+    template<typename W>
+    BasicResultTree<W> dfsTree(const BasicCsrView<W>& g, int source) {
+        return dfsKernel(BasicCsrAdjacency<W>{g}, source);
+    }
+
+    ResultTree dfsTree(const CompressedGraph& g, int source) {
+        return dfsKernel(CompressedAdjacency{g}, source);
+    }
+
+    ResultTree dfsTree(const DynamicGraph& g, int source) {
+        auto lock = g.readLock();
+        return dfsKernel(DynamicAdjacency{g}, source);
+    }
+
+    // DFS: builds DFS forest starting at source
+    // @param g      Graph to traverse (undirected or directed)
+    // @param source Start index for initial DFS (0-based)
+    // @return       New graph representing the DFS forest (tree edges)
+    Graph* dfs(const Graph& g, int source) {
+        return dfsTree(g, source).toGraph();
     }
 
     // relaxEdge: relaxes a single edge during Dijkstra
-    // @param u    Current vertex being processed
-    // @param e    Edge from u to v
-    // @param heap Min-heap of vertices keyed by distance
-    static void relaxEdge(Vertex* u, Edge* e, vertexHeap::VertexMinHeap& heap) {
-        Vertex* v = e->dest;
-        int alt = u->distance + e->weight;
-        if (alt < v->distance) {
+    // The sum is formed in the distance type (long long for integral
+    // weights), so it cannot overflow however narrow W is.
+    // @param u    Id of the vertex being settled
+    // @param v    Head of the arc
+    // @param w    Weight of the arc
+    // @param tree Distance/parent arrays being built
+    // @param heap Min-heap of vertex ids keyed by tree.distance
+    template<typename W>
+    static void relaxEdge(int u, int v, W w, BasicShortestPathTree<W>& tree,
+                          IndexMinHeap<DistanceOf<W>>& heap) {
+        DistanceOf<W> alt = tree.distance[u] + static_cast<DistanceOf<W>>(w);
+        if (alt < tree.distance[v]) {
             // Update shorter path and adjust heap
-            v->distance = alt;
-            v->father   = u;
-            heap.decreaseKey(v);
+            tree.distance[v] = alt;
+            tree.parent[v]   = u;
+            tree.weight[v]   = w;
+            heap.push(v);
         }
     }
 
-    // Dijkstra: shortest-paths tree via Dijkstra's algo
-    // @param g      Weighted graph to process
+    // dijkstraKernel: shortest-paths tree via Dijkstra's algo
+    // Per-vertex state lives in the result's id-indexed arrays and the heap
+    // holds ids, so the input graph is only read.
+    // @param g      Adjacency adapter over a weighted graph
     // @param source Start index (0-based) for source vertex
-    // @return       New graph of shortest-paths tree (directed)
-    Graph* dijkstra(const Graph& g, int source) {
-        int n = g.numVertices;
+    // @return       Directed tree with distances; order is the settle order
+    template<typename Adj>
+    static BasicShortestPathTree<typename Adj::Weight> dijkstraKernel(const Adj& g, int source) {
+        using W = typename Adj::Weight;
+        int n = g.numVertices();
         if (source < 0 || source >= n)
             throw st::out_of_range("dijkstra: source out of range");
 
-        // Initialize all distances to infinity and clear fathers
-        for (int i = 0; i < n; ++i) {
-            g.adjList[i]->distance = INT_MAX;
-            g.adjList[i]->father   = nullptr;
-        }
-
-        // Build a heap of all vertices
-        vertexHeap::VertexMinHeap heap;
-        for (int i = 0; i < n; ++i)
-            heap.insert(g.adjList[i]);
-
-        // Set source distance to zero and update heap
-        g.adjList[source]->distance = 0;
-        heap.decreaseKey(g.adjList[source]);
+        // Distances start at infinity (WeightTraits::unreachable) with no parents
+        BasicShortestPathTree<W> tree(n);
+        IndexMinHeap<DistanceOf<W>> heap(n, tree.distance.data());
+        tree.distance[source] = 0;
+        heap.insert(source);
 
         // Main loop: extract min and relax outgoing edges
         bool* visited = new bool[n]{};
         while (!heap.isEmpty()) {
-            Vertex* u = heap.extractMin();
-            int uid = u->data;
-            if (visited[uid]) continue;
-            visited[uid] = true;
-            for (Edge* e = u->edges; e; e = e->next)
-                relaxEdge(u, e, heap);
+            int u = heap.extractMin();
+            visited[u] = true;
+            tree.order.push_back(u);
+            forEachArc(g, u, [&](int v, W w) {
+                if (!visited[v])
+                    relaxEdge(u, v, w, tree, heap);
+            });
         }
         delete[] visited;
+        return tree;
+    }
 
-        // Build result graph by following father pointers
-        Graph* result = new Graph(n);
-        for (int i = 0; i < n; ++i) {
-            if (Vertex* p = g.adjList[i]->father) {
-                int w = g.adjList[i]->distance - p->distance;
-                result->addDirectedEdge(p->data, i, w);
-            }
-        }
-        return result;
+    ShortestPathTree dijkstraTree(const Graph& g, int source) {
+        return dijkstraKernel(ListAdjacency{g}, source);
     }
 
-    // Prim: MST via Prim's algo
-    // @param g Weighted undirected graph
-    // @return  New graph of minimum spanning tree
-    Graph* prim(const Graph& g) {
-        int n = g.numVertices;
-        if (n == 0)
-            throw st::invalid_argument("prim: empty graph");
+    template<typename W>
+    BasicShortestPathTree<W> dijkstraTree(const BasicCsrView<W>& g, int source) {
+        return dijkstraKernel(BasicCsrAdjacency<W>{g}, source);
+    }
 
-        // Initialize all distances to infinity and clear fathers
-        for (int i = 0; i < n; ++i) {
-            g.adjList[i]->distance = INT_MAX;
-            g.adjList[i]->father   = nullptr;
-        }
+    ShortestPathTree dijkstraTree(const CompressedGraph& g, int source) {
+        return dijkstraKernel(CompressedAdjacency{g}, source);
+    }
 
-        // Build a heap of all vertices
-        vertexHeap::VertexMinHeap heap;
-        for (int i = 0; i < n; ++i)
-            heap.insert(g.adjList[i]);
+    ShortestPathTree dijkstraTree(const DynamicGraph& g, int source) {
+        auto lock = g.readLock();
+        return dijkstraKernel(DynamicAdjacency{g}, source);
+    }
+
+    ShortestPathTree dijkstraTree(const StreamVByteGraph& g, int source) {
+        return dijkstraKernel(StreamVByteAdjacency{g}, source);
+    }
+
+    // Dijkstra: shortest-paths tree via Dijkstra's algo
+    // @param g      Weighted graph to process
+    // @param source Start index (0-based) for source vertex
+    // @return       New graph of shortest-paths tree (directed)
+    Graph* dijkstra(const Graph& g, int source) {
+        return dijkstraTree(g, source).toGraph();
+    }
 
-        // Start from vertex 0
-        g.adjList[0]->distance = 0;
-        heap.decreaseKey(g.adjList[0]);
+    // primKernel: MST via Prim's algo as a parent array
+    // Grows from vertex 0, then from the next unvisited vertex for every other
+    // component, so disconnected graphs give a minimum spanning forest.
+    // @param g Adjacency adapter over a weighted undirected graph
+    // @return  Undirected tree; order is the order vertices joined the MST
+    template<typename Adj>
+    static BasicResultTree<typename Adj::Weight> primKernel(const Adj& g) {
+        using W = typename Adj::Weight;
+        using D = DistanceOf<W>;
+        int n = g.numVertices();
+        if (n == 0)
+            throw st::invalid_argument("prim: empty graph");
 
+        // key[v]: lightest edge from the tree to v seen so far, kept in the
+        // wider distance type so "none yet" is above every weight
+        st::vector<D> key(n, WeightTraits<W>::unreachable());
+        IndexMinHeap<D> heap(n, key.data());
         bool* inMST = new bool[n]{};
-        Graph* result = new Graph(n);
-        // Extract and relax edges to grow MST
-        while (!heap.isEmpty()) {
-            Vertex* u = heap.extractMin();
-            int uid = u->data;
-            if (inMST[uid]) continue;
-            inMST[uid] = true;
-
-            if (u->father)
-                result->addEdge(u->father->data, uid, u->distance);
-
-            for (Edge* e = u->edges; e; e = e->next) {
-                Vertex* v = e->dest;
-                int w    = e->weight;
-                if (!inMST[v->data] && w < v->distance) {
-                    v->distance = w;
-                    v->father   = u;
-                    heap.decreaseKey(v);
-                }
+        BasicResultTree<W> tree(n, false);
+
+        for (int r = 0; r < n; ++r) {
+            if (inMST[r]) continue;
+            key[r] = D(0);
+            heap.insert(r);
+            // Extract and relax edges to grow MST
+            while (!heap.isEmpty()) {
+                int u = heap.extractMin();
+                inMST[u] = true;
+                tree.order.push_back(u);
+                forEachArc(g, u, [&](int v, W w) {
+                    if (!inMST[v] && static_cast<D>(w) < key[v]) {
+                        key[v] = w;
+                        tree.parent[v] = u;
+                        tree.weight[v] = w;
+                        heap.push(v);
+                    }
+                });
             }
         }
         delete[] inMST;
-        return result;
+        return tree;
     }
 
-    // Kruskal: MST via Kruskal's algo
-    // @param g Weighted undirected graph (modified by union-find)
-    // @return  New graph containing edges of the MST
+    ResultTree primTree(const Graph& g) {
+        return primKernel(ListAdjacency{g});
+    }
 
-    Graph* kruskal(Graph& g) {
-        int n = g.numVertices;
+    template<typename W>
+    BasicResultTree<W> primTree(const BasicCsrView<W>& g) {
+        return primKernel(BasicCsrAdjacency<W>{g});
+    }
+
+    ResultTree primTree(const CompressedGraph& g) {
+        return primKernel(CompressedAdjacency{g});
+    }
+
+    ResultTree primTree(const DynamicGraph& g) {
+        auto lock = g.readLock();
+        return primKernel(DynamicAdjacency{g});
+    }
+
+    ResultTree primTree(const StreamVByteGraph& g) {
+        return primKernel(StreamVByteAdjacency{g});
+    }
+
+    // Prim: MST via Prim's algo
+    // @param g Weighted undirected graph
+    // @return  New graph of minimum spanning tree
+    Graph* prim(const Graph& g) {
+        return primTree(g).toGraph();
+    }
+
+    // findRoot: union-find root with path halving
+    static int findRoot(st::vector<int>& uf, int v) {
+        while (uf[v] != v) {
+            uf[v] = uf[uf[v]];
+            v = uf[v];
+        }
+        return v;
+    }
+
+    // kruskalKernel: MST via Kruskal's algo as a parent array
+    // Union-find runs on a local array, so g is left untouched.
+    // @param g Adjacency adapter over a weighted undirected graph
+    // @return  Undirected forest, each tree rooted at its smallest vertex id
+    template<typename Adj>
+    static BasicResultTree<typename Adj::Weight> kruskalKernel(const Adj& g) {
+        using W = typename Adj::Weight;
+        using HeapEdge = edgeHeap::BasicHeapEdge<W>;
+        int n = g.numVertices();
         if (n < 0)
             throw st::invalid_argument("kruskal: negative vertex count");
-        if (n <= 1)
-            return new Graph(n);
-
-        // Reset father for union-find initialization
-        for (int i = 0; i < n; ++i)
-            g.adjList[i]->father = nullptr;
 
         // Build a heap of all unique edges
-        edgeHeap::EdgeMinHeap heap;
+        edgeHeap::BasicEdgeMinHeap<W> heap;
         for (int u = 0; u < n; ++u) {
-            for (Edge* e = g.adjList[u]->edges; e; e = e->next) {
-                int v = e->dest->data;
+            forEachArc(g, u, [&](int v, W w) {
                 if (u < v)
-                    heap.insert(edgeHeap::HeapEdge(u, v, e->weight));
+                    heap.insert(HeapEdge(u, v, w));
+            });
+        }
+
+        // Extract edges in increasing order and union if no cycle
+        st::vector<int> uf(n);
+        for (int i = 0; i < n; ++i) uf[i] = i;
+        st::vector<HeapEdge> chosen;
+        while (!heap.isEmpty() && static_cast<int>(chosen.size()) < n - 1) {
+            HeapEdge minE = heap.extractMin();
+            int ru = findRoot(uf, minE.from);
+            int rv = findRoot(uf, minE.to);
+            if (ru != rv) {
+                uf[ru] = rv;
+                chosen.push_back(minE);
             }
         }
 
-        Graph* result = new Graph(n);
-        int used = 0;
+        // Orient the chosen edges: CSR over the forest, then BFS from each root
+        st::vector<int> offsets(n + 1, 0);
+        for (const HeapEdge& e : chosen) {
+            ++offsets[e.from + 1];
+            ++offsets[e.to + 1];
+        }
+        for (int i = 0; i < n; ++i) offsets[i + 1] += offsets[i];
+        st::vector<int> fill(offsets.begin(), offsets.end() - 1);
+        st::vector<int> adj(offsets[n]);
+        st::vector<W> adjW(offsets[n]);
+        for (const HeapEdge& e : chosen) {
+            adj[fill[e.from]] = e.to;   adjW[fill[e.from]++] = e.weight;
+            adj[fill[e.to]]   = e.from; adjW[fill[e.to]++]   = e.weight;
+        }
 
-        // Extract edges in increasing order and union if no cycle
-        while (!heap.isEmpty() && used < n - 1) {
-            edgeHeap::HeapEdge minE = heap.extractMin();
-            Vertex* U  = g.adjList[minE.from];
-            Vertex* V = g.adjList[minE.to];
-            if (g.unionSets(U, V)) {
-                result->addEdge(minE.from, minE.to, minE.weight);
-                ++used;
+        BasicResultTree<W> tree(n, false);
+        st::vector<bool> seen(n, false);
+        for (int r = 0; r < n; ++r) {
+            if (seen[r]) continue;
+            seen[r] = true;
+            st::size_t head = tree.order.size();
+            tree.order.push_back(r);
+            for (; head < tree.order.size(); ++head) {
+                int u = tree.order[head];
+                for (int a = offsets[u]; a < offsets[u + 1]; ++a) {
+                    int v = adj[a];
+                    if (seen[v]) continue;
+                    seen[v] = true;
+                    tree.parent[v] = u;
+                    tree.weight[v] = adjW[a];
+                    tree.order.push_back(v);
+                }
             }
         }
+        return tree;
+    }
+
+    ResultTree kruskalTree(const Graph& g) {
+        return kruskalKernel(ListAdjacency{g});
+    }
+
+    template<typename W>
+    BasicResultTree<W> kruskalTree(const BasicCsrView<W>& g) {
+        return kruskalKernel(BasicCsrAdjacency<W>{g});
+    }
+
+    ResultTree kruskalTree(const CompressedGraph& g) {
+        return kruskalKernel(CompressedAdjacency{g});
+    }
+
+    ResultTree kruskalTree(const DynamicGraph& g) {
+        auto lock = g.readLock();
+        return kruskalKernel(DynamicAdjacency{g});
+    }
+
+    ResultTree kruskalTree(const StreamVByteGraph& g) {
+        return kruskalKernel(StreamVByteAdjacency{g});
+    }
+
+    // Kruskal: MST via Kruskal's algo
+    // @param g Weighted undirected graph
+    // @return  New graph containing edges of the MST
+    Graph* kruskal(Graph& g) {
+        return kruskalTree(g).toGraph();
+    }
 
-        return result;
+    // CSR entry points for every supported weight type (declared in Algorithms.hpp)
+#define GRAPH_INSTANTIATE_CSR_ALGORITHMS(W)                                          \
+    template BasicResultTree<W> bfsTree(const BasicCsrView<W>& g, int source);        \
+    template BasicResultTree<W> dfsTree(const BasicCsrView<W>& g, int source);        \
+    template BasicShortestPathTree<W> dijkstraTree(const BasicCsrView<W>& g, int source); \
+    template BasicResultTree<W> primTree(const BasicCsrView<W>& g);                   \
+    template BasicResultTree<W> kruskalTree(const BasicCsrView<W>& g);
+
+    GRAPH_INSTANTIATE_CSR_ALGORITHMS(st::uint16_t)
+    GRAPH_INSTANTIATE_CSR_ALGORITHMS(int)
+    GRAPH_INSTANTIATE_CSR_ALGORITHMS(long long)
+    GRAPH_INSTANTIATE_CSR_ALGORITHMS(float)
+    GRAPH_INSTANTIATE_CSR_ALGORITHMS(double)
+#undef GRAPH_INSTANTIATE_CSR_ALGORITHMS
+
+    template BasicResultTree<NoWeight> bfsTree(const UnweightedCsrView& g, int source);
+    template BasicResultTree<NoWeight> dfsTree(const UnweightedCsrView& g, int source);
+
+    // getHeight: height of the tree hanging from vertex (edges on the longest
+    // downward path), walked with an explicit stack so deep trees are safe.
+    // Works on the directed trees from bfs/dijkstra and on the undirected ones
+    // from dfs/prim/kruskal (one arc back to the parent is skipped).
+    // @param vertex Root vertex of a result tree
+    // @return       Height in edges; 0 for a single vertex
+    // @throws std::invalid_argument if vertex is null or a vertex is reached
+    //         twice (a cycle, e.g. an input graph rather than a tree)
+    int getHeight(Vertex* vertex) {
+        if (!vertex)
+            throw st::invalid_argument("getHeight: null vertex");
+
+        struct Frame { Vertex* v; Vertex* parent; int depth; };
+        st::vector<Frame> stack;
+        st::unordered_set<Vertex*> visited;
+        stack.push_back({vertex, nullptr, 0});
+        visited.insert(vertex);
+        int height = 0;
+        while (!stack.empty()) {
+            Frame f = stack.back();
+            stack.pop_back();
+            height = st::max(height, f.depth);
+            bool parentArcSkipped = false;
+            for (Edge* e = f.v->edges; e; e = e->next) {
+                if (e->dest == f.parent && !parentArcSkipped) {
+                    parentArcSkipped = true;
+                    continue;
+                }
+                if (!visited.insert(e->dest).second)
+                    throw st::invalid_argument("getHeight: graph is not a tree");
+                stack.push_back({e->dest, f.v, f.depth + 1});
+            }
+        }
+        return height;
     }
 
 }
@@ -3,6 +3,11 @@
 
 #pragma once
 #include "graph.hpp"
+#include "ResultTree.hpp"
+#include "CsrGraph.hpp"
+#include "CompressedGraph.hpp"
+#include "StreamVByteGraph.hpp"
+#include "DynamicGraph.hpp"
 
 namespace graph {
     // Algorithm functions
@@ -12,4 +17,51 @@ namespace graph {
     Graph* prim(const Graph& g);
     Graph* kruskal(Graph& g);
     int getHeight(Vertex* vertex);
+
+    // Value-returning variants: parent/weight arrays instead of a new Graph
+    // (call toGraph() on the result for the Graph form)
+    ResultTree bfsTree(const Graph& g, int source);
+    ResultTree dfsTree(const Graph& g, int source);
+    ShortestPathTree dijkstraTree(const Graph& g, int source);
+    ResultTree primTree(const Graph& g);
+    ResultTree kruskalTree(const Graph& g);
+
+    // The same algorithms over CSR arrays, e.g. a MappedGraph loaded from a
+    // graph file; results are identical to running on the source Graph.
+    // W is the CSR weight type (std::uint16_t, int, long long, float or
+    // double); trees keep W and distances use DistanceOf<W>.
+    template<typename W> BasicResultTree<W> bfsTree(const BasicCsrView<W>& g, int source);
+    template<typename W> BasicResultTree<W> dfsTree(const BasicCsrView<W>& g, int source);
+    template<typename W> BasicShortestPathTree<W> dijkstraTree(const BasicCsrView<W>& g, int source);
+    template<typename W> BasicResultTree<W> primTree(const BasicCsrView<W>& g);
+    template<typename W> BasicResultTree<W> kruskalTree(const BasicCsrView<W>& g);
+
+    // Unweighted CSR (W = NoWeight) runs bfsTree and dfsTree on the id arrays
+    // alone and returns trees without weights; the weighted algorithms do not apply
+    BasicShortestPathTree<NoWeight> dijkstraTree(const UnweightedCsrView& g, int source) = delete;
+    BasicResultTree<NoWeight> primTree(const UnweightedCsrView& g) = delete;
+    BasicResultTree<NoWeight> kruskalTree(const UnweightedCsrView& g) = delete;
+
+    // ... and over compressed lists; neighbours are visited in ascending id
+    // order, so ties may resolve differently than on the source Graph
+    ResultTree bfsTree(const CompressedGraph& g, int source);
+    ResultTree dfsTree(const CompressedGraph& g, int source);
+    ShortestPathTree dijkstraTree(const CompressedGraph& g, int source);
+    ResultTree primTree(const CompressedGraph& g);
+    ResultTree kruskalTree(const CompressedGraph& g);
+
+    // ... and over SIMD-decoded Stream VByte blocks (no dfsTree: DFS must
+    // suspend a list mid-block, which the block format does not support)
+    ResultTree bfsTree(const StreamVByteGraph& g, int source);
+    ShortestPathTree dijkstraTree(const StreamVByteGraph& g, int source);
+    ResultTree primTree(const StreamVByteGraph& g);
+    ResultTree kruskalTree(const StreamVByteGraph& g);
+
+    // ... and over a DynamicGraph, skipping tombstoned arcs; each call holds
+    // the graph's shared lock, so it sees one consistent state
+    ResultTree bfsTree(const DynamicGraph& g, int source);
+    ResultTree dfsTree(const DynamicGraph& g, int source);
+    ShortestPathTree dijkstraTree(const DynamicGraph& g, int source);
+    ResultTree primTree(const DynamicGraph& g);
+    ResultTree kruskalTree(const DynamicGraph& g);
 }
\ No newline at end of file
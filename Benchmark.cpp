@@ -0,0 +1,391 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#include "graph.hpp"
+#include "Algorithms.hpp"
+#include "CompressedGraph.hpp"
+#include "StreamVByte.hpp"
+#include "StreamVByteGraph.hpp"
+#include "CsrGraph.hpp"
+#include "Reorder.hpp"
+#include "DynamicGraph.hpp"
+#include "IncrementalSssp.hpp"
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace gr = graph;
+namespace st = std;
+
+// Microbenchmarks for the performance-sensitive pieces of the library.
+// Usage: bench [section...]   (no arguments runs every section)
+
+using Clock = st::chrono::steady_clock;
+
+static double secondsSince(Clock::time_point start) {
+    return st::chrono::duration<double>(Clock::now() - start).count();
+}
+
+// Run fn repeatedly for at least minSeconds; return seconds per call.
+template<typename Fn>
+static double timePerCall(Fn&& fn, double minSeconds = 0.3) {
+    fn();  // warm-up
+    int calls = 0;
+    Clock::time_point start = Clock::now();
+    double elapsed;
+    do {
+        fn();
+        ++calls;
+        elapsed = secondsSince(start);
+    } while (elapsed < minSeconds);
+    return elapsed / calls;
+}
+
+static const char* kernelName(gr::VByteKernel k) {
+    switch (k) {
+    case gr::VByteKernel::Scalar: return "scalar";
+    case gr::VByteKernel::Sse41:  return "sse4.1";
+    case gr::VByteKernel::Avx2:   return "avx2";
+    default:                      return "auto";
+    }
+}
+
+// Stream VByte decode bandwidth: one long stream, and 64-id blocks as the
+// graph iterator decodes them, for small (1-byte) and mixed gaps.
+static void benchDecode() {
+    st::cout << "\n=== Stream VByte decode ===" << st::endl;
+    const st::size_t count = 1 << 22;
+    st::mt19937 rng(7);
+    const gr::VByteKernel kernels[] = {gr::VByteKernel::Scalar, gr::VByteKernel::Sse41,
+                                       gr::VByteKernel::Avx2};
+
+    for (int mixed = 0; mixed < 2; ++mixed) {
+        st::vector<st::uint32_t> values(count);
+        st::uint32_t x = 0;
+        for (st::size_t i = 0; i < count; ++i) {
+            st::uint32_t gap = rng() % 64;
+            if (mixed) gap = rng() >> (8 * (rng() % 4));
+            values[i] = (x += gap);
+        }
+        st::vector<st::uint8_t> stream(gr::streamVByteMaxBytes(count));
+        stream.resize(gr::streamVByteEncodeDelta(values.data(), count, stream.data()));
+
+        // the same values as independent blocks of kVByteBlock
+        st::vector<st::uint8_t> blocks(gr::streamVByteMaxBytes(count));
+        st::size_t used = 0;
+        for (st::size_t i = 0; i < count; i += gr::kVByteBlock)
+            used += gr::streamVByteEncodeDelta(values.data() + i, gr::kVByteBlock,
+                                               blocks.data() + used, i ? values[i - 1] : 0);
+        blocks.resize(used);
+
+        st::cout << (mixed ? "mixed gaps" : "small gaps") << ": "
+                 << st::fixed << st::setprecision(2)
+                 << 8.0 * stream.size() / count << " bits/id" << st::endl;
+        st::vector<st::uint32_t> out(count);
+        for (gr::VByteKernel k : kernels) {
+            if (!gr::vbyteKernelSupported(k)) {
+                st::cout << "  " << st::setw(7) << kernelName(k) << "  (not supported)" << st::endl;
+                continue;
+            }
+            double whole = timePerCall([&]() {
+                gr::streamVByteDecodeDelta(stream.data(), count, out.data(), 0, k);
+            });
+            double blocked = timePerCall([&]() {
+                const st::uint8_t* p = blocks.data();
+                for (st::size_t i = 0; i < count; i += gr::kVByteBlock)
+                    p += gr::streamVByteDecodeDelta(p, gr::kVByteBlock, out.data() + i,
+                                                    i ? out[i - 1] : 0, k);
+            });
+            if (st::memcmp(out.data(), values.data(), count * sizeof(st::uint32_t)) != 0)
+                st::cout << "  decode mismatch!" << st::endl;
+            st::cout << "  " << st::setw(7) << kernelName(k)
+                     << "  stream " << st::setw(8) << count / whole / 1e6 << " Mids/s "
+                     << st::setw(6) << 4.0 * count / whole / 1e9 << " GB/s"
+                     << "   blocks " << st::setw(8) << count / blocked / 1e6 << " Mids/s "
+                     << st::setw(6) << 4.0 * count / blocked / 1e9 << " GB/s" << st::endl;
+        }
+    }
+}
+
+// BFS over the same random graph in each adjacency representation.
+static void benchTraversal() {
+    st::cout << "\n=== BFS by adjacency format ===" << st::endl;
+    const int n = 200000, degree = 8;
+    st::mt19937 rng(11);
+    gr::Graph g(n);
+    st::vector<gr::EdgeTriple> edges;
+    edges.reserve(static_cast<st::size_t>(n) * degree / 2);
+    for (int u = 0; u < n; ++u)
+        for (int k = 0; k < degree / 2; ++k)
+            edges.push_back({u, static_cast<int>(rng() % n), 1 + static_cast<int>(rng() % 100)});
+    g.addEdges(edges);
+    gr::CompressedGraph varint(g);
+    gr::StreamVByteGraph blocks(g);
+    gr::CsrGraph csr(g);
+    gr::UnweightedCsrGraph ids(g);
+
+    double list = timePerCall([&]() { gr::bfsTree(g, 0); });
+    double wcsr = timePerCall([&]() { gr::bfsTree(csr.view(), 0); });
+    double ucsr = timePerCall([&]() { gr::bfsTree(ids.view(), 0); });
+    double var  = timePerCall([&]() { gr::bfsTree(varint, 0); });
+    double svb  = timePerCall([&]() { gr::bfsTree(blocks, 0); });
+    double arcs = 2.0 * edges.size();
+    st::cout << st::fixed << st::setprecision(1)
+             << "  linked lists  " << st::setw(7) << list * 1e3 << " ms  "
+             << st::setw(6) << arcs * sizeof(gr::Edge) / 1e6 << " MB of Edge nodes" << st::endl
+             << "  csr           " << st::setw(7) << wcsr * 1e3 << " ms  "
+             << st::setw(6) << (csr.offsets.size() + 2 * arcs) * sizeof(int) / 1e6 << " MB" << st::endl
+             << "  csr, no wts   " << st::setw(7) << ucsr * 1e3 << " ms  "
+             << st::setw(6) << (ids.offsets.size() + arcs) * sizeof(int) / 1e6 << " MB" << st::endl
+             << "  varint        " << st::setw(7) << var * 1e3 << " ms  "
+             << st::setw(6) << varint.memoryBytes() / 1e6 << " MB" << st::endl
+             << "  stream vbyte  " << st::setw(7) << svb * 1e3 << " ms  "
+             << st::setw(6) << blocks.memoryBytes() / 1e6 << " MB" << st::endl;
+}
+
+// Hardware cache-miss counter for the calling thread (perf_event_open).
+// valid() is false where perf events are unavailable (non-Linux, or
+// perf_event_paranoid / container policy); callers then report time only.
+class CacheMissCounter {
+public:
+    CacheMissCounter() {
+#if defined(__linux__)
+        perf_event_attr attr;
+        st::memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.config = PERF_COUNT_HW_CACHE_MISSES;
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        fd_ = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+#endif
+    }
+    ~CacheMissCounter() {
+#if defined(__linux__)
+        if (fd_ >= 0) close(fd_);
+#endif
+    }
+    CacheMissCounter(const CacheMissCounter&) = delete;
+    CacheMissCounter& operator=(const CacheMissCounter&) = delete;
+
+    bool valid() const { return fd_ >= 0; }
+
+    // Misses during one call of fn, or -1 without a counter.
+    template<typename Fn>
+    long long measure(Fn&& fn) {
+#if defined(__linux__)
+        if (fd_ >= 0) {
+            ioctl(fd_, PERF_EVENT_IOC_RESET, 0);
+            ioctl(fd_, PERF_EVENT_IOC_ENABLE, 0);
+            fn();
+            ioctl(fd_, PERF_EVENT_IOC_DISABLE, 0);
+            long long count = 0;
+            if (read(fd_, &count, sizeof(count)) == static_cast<ssize_t>(sizeof(count)))
+                return count;
+            return -1;
+        }
+#endif
+        fn();
+        return -1;
+    }
+
+private:
+    int fd_ = -1;
+};
+
+// BFS and Dijkstra over a CSR snapshot of a scrambled grid with a few
+// random shortcuts, before and after each reordering.
+static void benchReorder() {
+    st::cout << "\n=== Vertex reordering (CSR, scrambled 600x600 grid) ===" << st::endl;
+    const int side = 600, n = side * side;
+    st::mt19937 rng(13);
+    st::vector<int> scramble(n);
+    for (int v = 0; v < n; ++v) scramble[v] = v;
+    st::shuffle(scramble.begin(), scramble.end(), rng);
+    st::vector<gr::EdgeTriple> edges;
+    for (int r = 0; r < side; ++r)
+        for (int c = 0; c < side; ++c) {
+            int v = r * side + c;
+            int w = 1 + static_cast<int>(rng() % 20);
+            if (c + 1 < side) edges.push_back({scramble[v], scramble[v + 1], w});
+            if (r + 1 < side) edges.push_back({scramble[v], scramble[v + side], w});
+            if (rng() % 50 == 0) edges.push_back({scramble[v], static_cast<int>(rng() % n), w});
+        }
+    gr::Graph g(n);
+    g.addEdges(edges);
+    gr::CsrGraph input(g);
+
+    CacheMissCounter counter;
+    if (!counter.valid())
+        st::cout << "  (hardware cache-miss counters unavailable; timing only)" << st::endl;
+
+    struct Variant { const char* name; double buildMs; gr::CsrGraph csr; int source; };
+    st::vector<Variant> variants;
+    variants.push_back({"input order", 0.0, input, 0});
+    auto add = [&](const char* name, gr::VertexOrder (*make)(const gr::CsrView&)) {
+        Clock::time_point start = Clock::now();
+        gr::VertexOrder order = make(input.view());
+        gr::CsrGraph csr = gr::relabel(input.view(), order);
+        double ms = secondsSince(start) * 1e3;
+        variants.push_back({name, ms, st::move(csr), order.toNew(0)});
+    };
+    add("rcm", gr::reverseCuthillMcKee);
+    add("degree", gr::degreeOrder);
+    add("gorder", [](const gr::CsrView& v) { return gr::gorderOrder(v); });
+
+    st::cout << "  " << st::left << st::setw(12) << "order" << st::right
+             << st::setw(10) << "reorder" << st::setw(10) << "bfs"
+             << st::setw(14) << "bfs misses" << st::setw(11) << "dijkstra"
+             << st::setw(15) << "dijk. misses" << st::endl;
+    for (const Variant& v : variants) {
+        gr::CsrView view = v.csr.view();
+        double bfs = timePerCall([&]() { gr::bfsTree(view, v.source); });
+        double dij = timePerCall([&]() { gr::dijkstraTree(view, v.source); });
+        long long bfsMisses = counter.measure([&]() { gr::bfsTree(view, v.source); });
+        long long dijMisses = counter.measure([&]() { gr::dijkstraTree(view, v.source); });
+        auto misses = [](long long m) { return m < 0 ? st::string("n/a") : st::to_string(m); };
+        st::cout << "  " << st::left << st::setw(12) << v.name << st::right << st::fixed
+                 << st::setprecision(1)
+                 << st::setw(8) << v.buildMs << "ms" << st::setw(8) << bfs * 1e3 << "ms"
+                 << st::setw(14) << misses(bfsMisses) << st::setw(9) << dij * 1e3 << "ms"
+                 << st::setw(15) << misses(dijMisses) << st::endl;
+    }
+}
+
+// Edge churn (remove a random live edge, add a fresh one) on linked lists
+// and on tombstoned blocks, then one BFS over the churned graph.
+static void benchChurn() {
+    st::cout << "\n=== Edge churn: linked lists vs tombstoned blocks ===" << st::endl;
+    const int n = 100000, degree = 8, rounds = 400000;
+    st::mt19937 rng(17);
+    st::vector<gr::EdgeTriple> edges;
+    for (int u = 0; u < n; ++u)
+        for (int k = 0; k < degree / 2; ++k)
+            edges.push_back({u, static_cast<int>(rng() % n), 1 + static_cast<int>(rng() % 100)});
+    // the same random operations for both graphs
+    st::vector<st::size_t> victims(rounds);
+    st::vector<gr::EdgeTriple> fresh(rounds);
+    for (int i = 0; i < rounds; ++i) {
+        victims[i] = rng();
+        fresh[i] = {static_cast<int>(rng() % n), static_cast<int>(rng() % n), 1};
+    }
+
+    auto run = [&](auto& g, const char* name) {
+        st::vector<gr::EdgeTriple> live = edges;
+        Clock::time_point start = Clock::now();
+        for (int i = 0; i < rounds; ++i) {
+            st::size_t at = victims[i] % live.size();
+            g.removeEdge(live[at].u, live[at].v);
+            live[at] = fresh[i];
+            g.addEdge(fresh[i].u, fresh[i].v, fresh[i].weight);
+        }
+        double churn = secondsSince(start);
+        double bfs = timePerCall([&]() { gr::bfsTree(g, 0); });
+        st::cout << "  " << st::left << st::setw(16) << name << st::right << st::fixed
+                 << st::setprecision(1) << st::setw(8) << churn * 1e3 << " ms churn  "
+                 << st::setw(7) << bfs * 1e3 << " ms bfs" << st::endl;
+    };
+    {
+        gr::Graph g(n);
+        g.addEdges(edges);
+        run(g, "linked lists");
+    }
+    {
+        gr::Graph seed(n);
+        seed.addEdges(edges);
+        gr::DynamicGraph g(seed);
+        run(g, "tombstones");
+        g.waitForCompaction();
+        st::cout << "  (" << g.compactedBlocks() << " blocks compacted in the background)" << st::endl;
+    }
+}
+
+// Incremental SSSP against rerunning Dijkstra after every update: random
+// insertions, weight decreases and deletions on a random graph.
+static void benchSssp() {
+    st::cout << "\n=== Incremental SSSP vs full recomputation ===" << st::endl;
+    const int n = 200000, degree = 8, updates = 3000;
+    st::mt19937 rng(19);
+    st::vector<gr::EdgeTriple> edges;
+    for (int u = 0; u < n; ++u)
+        for (int k = 0; k < degree / 2; ++k) {
+            int v = static_cast<int>(rng() % n);
+            if (v != u) edges.push_back({u, v, 1 + static_cast<int>(rng() % 100)});
+        }
+    gr::Graph g(n);
+    g.addEdges(edges);
+    gr::CsrGraph csr(g);
+    double fullList = timePerCall([&]() { gr::dijkstraTree(g, 0); });
+    double fullCsr  = timePerCall([&]() { gr::dijkstraTree(csr.view(), 0); });
+
+    gr::IncrementalShortestPaths inc(g, 0);
+    const char* names[3] = {"insert", "decrease", "delete"};
+    double seconds[3] = {0, 0, 0};
+    long long touched[3] = {0, 0, 0};
+    int counts[3] = {0, 0, 0};
+    for (int i = 0; i < updates; ++i) {
+        int op = i % 3;
+        Clock::time_point start = Clock::now();
+        if (op == 0) {
+            gr::EdgeTriple e{static_cast<int>(rng() % n), static_cast<int>(rng() % n),
+                             1 + static_cast<int>(rng() % 100)};
+            touched[op] += inc.addEdge(e.u, e.v, e.weight);
+            edges.push_back(e);
+        } else {
+            st::size_t at = rng() % edges.size();
+            gr::EdgeTriple& e = edges[at];
+            if (op == 1) {
+                // 1 is never above the weight of whichever parallel edge is found first
+                e.weight = 1;
+                touched[op] += inc.decreaseWeight(e.u, e.v, e.weight);
+            } else {
+                touched[op] += inc.removeEdge(e.u, e.v);
+                e = edges.back();
+                edges.pop_back();
+            }
+        }
+        seconds[op] += secondsSince(start);
+        ++counts[op];
+    }
+
+    st::cout << st::fixed << st::setprecision(1)
+             << "  full dijkstra: " << fullList * 1e3 << " ms (linked lists), "
+             << fullCsr * 1e3 << " ms (csr)" << st::endl;
+    for (int op = 0; op < 3; ++op) {
+        double per = seconds[op] / counts[op];
+        st::cout << "  " << st::left << st::setw(9) << names[op] << st::right
+                 << st::setprecision(3) << st::setw(9) << per * 1e6 << " us/update  "
+                 << st::setprecision(1) << st::setw(8)
+                 << static_cast<double>(touched[op]) / counts[op] << " vertices  "
+                 << st::setw(8) << fullCsr / per << "x vs csr" << st::endl;
+    }
+}
+
+int main(int argc, char** argv) {
+    struct Section { const char* name; void (*run)(); };
+    const Section sections[] = {
+        {"decode", benchDecode},
+        {"traversal", benchTraversal},
+        {"reorder", benchReorder},
+        {"churn", benchChurn},
+        {"sssp", benchSssp},
+    };
+    for (const Section& s : sections) {
+        bool selected = argc < 2;
+        for (int i = 1; i < argc; ++i)
+            if (st::string(argv[i]) == s.name) selected = true;
+        if (selected) s.run();
+    }
+    return 0;
+}
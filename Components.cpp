@@ -0,0 +1,267 @@
+#include "Components.hpp"
+#include "CsrGraph.hpp"
+#include "Parallel.hpp"
+#include <atomic>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+
+namespace st = std;
+
+namespace graph {
+
+// ---------------------------------------------------------------------------
+// Connected components (Afforest)
+// ---------------------------------------------------------------------------
+
+using Labels = st::vector<st::atomic<int>>;
+
+// Neighbour-sampling rounds before the giant component is identified.
+static const int kNeighborRounds = 2;
+// Vertices sampled to guess the giant component.
+static const int kComponentSamples = 1024;
+
+// link: merge the trees of u and v by hooking the larger root under the
+// smaller one. Labels only ever decrease, so each tree root is its minimum id.
+static void link(Labels& comp, int u, int v) {
+    int p1 = comp[u].load(st::memory_order_relaxed);
+    int p2 = comp[v].load(st::memory_order_relaxed);
+    while (p1 != p2) {
+        int high = p1 > p2 ? p1 : p2;
+        int low  = p1 > p2 ? p2 : p1;
+        int pHigh = comp[high].load(st::memory_order_relaxed);
+        if (pHigh == low) break;
+        if (pHigh == high &&
+            comp[high].compare_exchange_strong(pHigh, low, st::memory_order_relaxed))
+            break;
+        p1 = comp[comp[high].load(st::memory_order_relaxed)].load(st::memory_order_relaxed);
+        p2 = comp[low].load(st::memory_order_relaxed);
+    }
+}
+
+// compress: point every vertex directly at its root.
+static void compress(Labels& comp, int numThreads) {
+    parallelFor(static_cast<int>(comp.size()), numThreads, [&](int v) {
+        int p = comp[v].load(st::memory_order_relaxed);
+        int pp = comp[p].load(st::memory_order_relaxed);
+        while (p != pp) {
+            comp[v].store(pp, st::memory_order_relaxed);
+            p = pp;
+            pp = comp[p].load(st::memory_order_relaxed);
+        }
+    });
+}
+
+// Most frequent label among a fixed pseudo-random sample of vertices.
+static int sampleFrequentLabel(const Labels& comp) {
+    st::unordered_map<int, int> counts;
+    unsigned seed = 0x9e3779b9u;
+    int n = static_cast<int>(comp.size());
+    int best = 0, bestCount = 0;
+    for (int i = 0; i < kComponentSamples; ++i) {
+        seed = seed * 1664525u + 1013904223u;
+        int label = comp[seed % n].load(st::memory_order_relaxed);
+        int c = ++counts[label];
+        if (c > bestCount) {
+            bestCount = c;
+            best = label;
+        }
+    }
+    return best;
+}
+
+// Only arc heads are read, so the Graph overload snapshots into an
+// unweighted CSR and never copies a weight.
+st::vector<int> connectedComponents(const Graph& g, int numThreads) {
+    if (numThreads < 0)
+        throw st::invalid_argument("connectedComponents: negative thread count");
+    UnweightedCsrGraph csr(g);
+    return connectedComponents(csr.view(), numThreads);
+}
+
+st::vector<int> connectedComponents(const UnweightedCsrView& csr, int numThreads) {
+    if (numThreads < 0)
+        throw st::invalid_argument("connectedComponents: negative thread count");
+    numThreads = resolveThreadCount(numThreads);
+    const int n = csr.numVertices;
+    if (n == 0) return {};
+
+    Labels comp(n);
+    parallelFor(n, numThreads, [&](int v) { comp[v].store(v, st::memory_order_relaxed); });
+
+    // Sampling: link each vertex to its r-th neighbour only.
+    for (int r = 0; r < kNeighborRounds; ++r) {
+        parallelFor(n, numThreads, [&](int u) {
+            if (csr.degree(u) > r)
+                link(comp, u, csr.dests[csr.offsets[u] + r]);
+        });
+        compress(comp, numThreads);
+    }
+
+    // Finish the remaining arcs, skipping the (likely) giant component: its
+    // vertices are reached through the reverse arcs of everyone else.
+    const int giant = sampleFrequentLabel(comp);
+    parallelFor(n, numThreads, [&](int u) {
+        if (comp[u].load(st::memory_order_relaxed) == giant) return;
+        for (int a = csr.offsets[u] + kNeighborRounds; a < csr.offsets[u + 1]; ++a)
+            link(comp, u, csr.dests[a]);
+    });
+    compress(comp, numThreads);
+
+    st::vector<int> labels(n);
+    for (int v = 0; v < n; ++v)
+        labels[v] = comp[v].load(st::memory_order_relaxed);
+    return labels;
+}
+
+// ---------------------------------------------------------------------------
+// Strongly connected components (Pearce)
+// ---------------------------------------------------------------------------
+
+// Pearce's variant of Tarjan: rindex[v] holds the DFS index while v is open
+// and is overwritten with the component number (counting down from n-1) when
+// its component completes, so no separate lowlink or on-stack arrays are kept.
+st::vector<int> stronglyConnectedComponents(const Graph& g) {
+    const int n = g.numVertices;
+    st::vector<int>  rindex(n, 0);
+    st::vector<bool> root(n, false);
+    st::vector<int>  members;                      // vertices waiting for their root
+    st::vector<st::pair<int, Edge*>> stack;        // DFS path with edge cursors
+    int index = 1;
+    int comp  = n - 1;
+
+    auto open = [&](int v) {
+        rindex[v] = index++;
+        root[v] = true;
+        stack.emplace_back(v, g.adjList[v]->edges);
+    };
+
+    for (int s = 0; s < n; ++s) {
+        if (rindex[s] != 0) continue;
+        open(s);
+        while (!stack.empty()) {
+            int v = stack.back().first;
+            Edge* e = stack.back().second;
+            if (e) {
+                stack.back().second = e->next;
+                int w = e->dest->data;
+                if (rindex[w] == 0) {
+                    open(w);
+                } else if (rindex[w] < rindex[v]) {
+                    rindex[v] = rindex[w];
+                    root[v] = false;
+                }
+                continue;
+            }
+
+            // All edges of v done: close its component or defer to the root.
+            stack.pop_back();
+            if (root[v]) {
+                --index;
+                while (!members.empty() && rindex[v] <= rindex[members.back()]) {
+                    rindex[members.back()] = comp;
+                    members.pop_back();
+                    --index;
+                }
+                rindex[v] = comp--;
+            } else {
+                members.push_back(v);
+            }
+            if (!stack.empty()) {
+                int u = stack.back().first;
+                if (rindex[v] < rindex[u]) {
+                    rindex[u] = rindex[v];
+                    root[u] = false;
+                }
+            }
+        }
+    }
+
+    // Renumber so the first completed component is 0.
+    for (int v = 0; v < n; ++v)
+        rindex[v] = (n - 1) - rindex[v];
+    return rindex;
+}
+
+// ---------------------------------------------------------------------------
+// Bridges, articulation points, biconnected components
+// ---------------------------------------------------------------------------
+
+// DFS frame for analyzeBiconnectivity.
+struct LowlinkFrame {
+    int   vertex;
+    int   parent;
+    Edge* cursor;
+    bool  parentArcSkipped;  // only one arc back to the parent is the tree edge
+};
+
+static st::pair<int, int> ordered(int u, int v) {
+    return u < v ? st::make_pair(u, v) : st::make_pair(v, u);
+}
+
+Biconnectivity analyzeBiconnectivity(const Graph& g) {
+    const int n = g.numVertices;
+    Biconnectivity result;
+    st::vector<int>  disc(n, -1), low(n, 0);
+    st::vector<bool> isCut(n, false);
+    st::vector<st::pair<int, int>> edgeStack;
+    st::vector<LowlinkFrame> stack;
+    int timer = 0;
+
+    for (int s = 0; s < n; ++s) {
+        if (disc[s] >= 0) continue;
+        disc[s] = low[s] = timer++;
+        stack.push_back({s, -1, g.adjList[s]->edges, false});
+        int rootChildren = 0;
+
+        while (!stack.empty()) {
+            LowlinkFrame& f = stack.back();
+            int v = f.vertex;
+            if (Edge* e = f.cursor) {
+                f.cursor = e->next;
+                int w = e->dest->data;
+                if (w == v) continue;
+                if (w == f.parent && !f.parentArcSkipped) {
+                    f.parentArcSkipped = true;
+                    continue;
+                }
+                if (disc[w] < 0) {
+                    edgeStack.emplace_back(v, w);
+                    disc[w] = low[w] = timer++;
+                    if (v == s) ++rootChildren;
+                    stack.push_back({w, v, g.adjList[w]->edges, false});
+                } else if (disc[w] < disc[v]) {
+                    edgeStack.emplace_back(v, w);
+                    low[v] = st::min(low[v], disc[w]);
+                }
+                continue;
+            }
+
+            // v is finished: report what the tree edge (parent, v) separates.
+            int parent = f.parent;
+            stack.pop_back();
+            if (parent < 0) continue;
+            low[parent] = st::min(low[parent], low[v]);
+            if (low[v] > disc[parent])
+                result.bridges.push_back(ordered(parent, v));
+            if (low[v] >= disc[parent]) {
+                if (parent != s) isCut[parent] = true;
+                st::vector<st::pair<int, int>> block;
+                for (;;) {
+                    st::pair<int, int> top = edgeStack.back();
+                    edgeStack.pop_back();
+                    block.push_back(ordered(top.first, top.second));
+                    if (top.first == parent && top.second == v) break;
+                }
+                result.components.push_back(st::move(block));
+            }
+        }
+        if (rootChildren >= 2) isCut[s] = true;
+    }
+
+    for (int v = 0; v < n; ++v)
+        if (isCut[v]) result.articulationPoints.push_back(v);
+    return result;
+}
+
+}
@@ -0,0 +1,50 @@
+#pragma once
+#include "graph.hpp"
+#include "CsrGraph.hpp"
+#include <utility>
+#include <vector>
+
+namespace graph {
+
+/// @brief Connected components of an undirected graph.
+/// Parallel hook-and-compress (Shiloach-Vishkin style linking of the larger
+/// root under the smaller one) with Afforest neighbour sampling: a couple of
+/// rounds over the first neighbours of every vertex find the giant component,
+/// whose vertices are then skipped when the remaining edges are linked.
+/// @param g          Undirected graph (both arcs of every edge present)
+/// @param numThreads Worker count; 0 selects std::thread::hardware_concurrency()
+/// @return Label per vertex: the smallest vertex id in its component
+/// @throws std::invalid_argument if numThreads < 0.
+std::vector<int> connectedComponents(const Graph& g, int numThreads = 0);
+
+/// @brief Connected components over unweighted CSR id arrays (both arcs of
+/// every edge present); same labels as the Graph overload.
+std::vector<int> connectedComponents(const UnweightedCsrView& g, int numThreads = 0);
+
+/// @brief Strongly connected components of a directed graph.
+/// Iterative Pearce/Tarjan: one DFS pass with an explicit stack (no
+/// recursion) and a single rindex array doubling as lowlink and result.
+/// @param g Directed graph (edges from addDirectedEdge; undirected edges count both ways)
+/// @return Component id per vertex in [0, #components); ids follow the order
+///         in which components complete, i.e. a reverse topological order of
+///         the condensation (sink components first)
+std::vector<int> stronglyConnectedComponents(const Graph& g);
+
+/// @brief Single points of failure of an undirected graph.
+struct Biconnectivity {
+    /// Edges whose removal disconnects their component, as (u, v) with u < v.
+    std::vector<std::pair<int, int>> bridges;
+    /// Vertices whose removal disconnects their component, ascending.
+    std::vector<int> articulationPoints;
+    /// Biconnected components (blocks), each as its list of edges (u, v) with u < v.
+    std::vector<std::vector<std::pair<int, int>>> components;
+};
+
+/// @brief Bridges, articulation points and biconnected components in one
+/// iterative DFS lowlink pass, O(V + E), no recursion.
+/// Parallel edges are handled (a doubled edge is never a bridge); self-loops
+/// are ignored.
+/// @param g Undirected graph (both arcs of every edge present)
+Biconnectivity analyzeBiconnectivity(const Graph& g);
+
+}
@@ -0,0 +1,55 @@
+#include "CompressedGraph.hpp"
+#include <utility>
+
+namespace st = std;
+
+namespace graph {
+
+static void writeVarint(st::vector<st::uint8_t>& out, st::uint32_t value) {
+    while (value >= 0x80) {
+        out.push_back(static_cast<st::uint8_t>(value | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<st::uint8_t>(value));
+}
+
+static st::uint32_t zigzag(long long delta) {
+    st::uint64_t bits = static_cast<st::uint64_t>(delta);
+    return static_cast<st::uint32_t>((bits << 1) ^ (delta < 0 ? ~0ULL : 0ULL));
+}
+
+// Encode the sorted ids; offsets and weights are taken over as they are.
+void CompressedGraph::build(SortedLists& lists) {
+    byteOffsets_.assign(numVertices_ + 1, 0);
+    for (int u = 0; u < numVertices_; ++u) {
+        byteOffsets_[u] = bytes_.size();
+        long long prev = u;
+        for (int i = lists.arcOffsets[u]; i < lists.arcOffsets[u + 1]; ++i) {
+            long long v = lists.dests[i];
+            if (i == lists.arcOffsets[u]) writeVarint(bytes_, zigzag(v - prev));
+            else                          writeVarint(bytes_, static_cast<st::uint32_t>(v - prev));
+            prev = v;
+        }
+    }
+    byteOffsets_[numVertices_] = bytes_.size();
+    bytes_.shrink_to_fit();
+    arcOffsets_ = st::move(lists.arcOffsets);
+    weights_ = st::move(lists.weights);
+    weights_.shrink_to_fit();
+}
+
+CompressedGraph::CompressedGraph(const Graph& g) : numVertices_(g.numVertices) {
+    SortedLists lists(g);
+    build(lists);
+}
+
+CompressedGraph::CompressedGraph(const CsrView& csr) : numVertices_(csr.numVertices) {
+    SortedLists lists(csr);
+    build(lists);
+}
+
+st::size_t CompressedGraph::memoryBytes() const {
+    return encodedMemoryBytes(bytes_, weights_, byteOffsets_, arcOffsets_);
+}
+
+}
@@ -0,0 +1,108 @@
+#pragma once
+#include "graph.hpp"
+#include "CsrGraph.hpp"
+#include "SortedLists.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace graph {
+
+/// @brief Read-only adjacency with delta + varint compressed neighbour ids.
+/// Each vertex's neighbours are sorted by id. The first neighbour is stored
+/// as the zigzag-coded difference from the vertex itself, and each later
+/// one as the gap from its predecessor. Every value is a LEB128 varint (7
+/// bits per byte), so local graphs need about one byte per arc instead of
+/// a 32-byte Edge node. Weights are kept as a separate int array in the
+/// same sorted order. Lists are decoded on the fly by NeighborIterator.
+class CompressedGraph {
+public:
+    /// @brief One decoded arc.
+    struct Neighbor {
+        int dest;
+        int weight;
+    };
+
+    /// @brief End marker for range-for over neighbors().
+    struct NeighborEnd {};
+
+    /// @brief Forward iterator that decodes one vertex's list as it advances.
+    class NeighborIterator {
+    private:
+        const std::uint8_t* bytes_;
+        const int*          weights_;
+        int                 remaining_;  ///< arcs left, including the current one
+        int                 dest_;
+
+    public:
+        NeighborIterator(const std::uint8_t* bytes, const int* weights, int count, int vertex)
+            : bytes_(bytes), weights_(weights), remaining_(count), dest_(vertex) {
+            if (remaining_ > 0) dest_ += unzigzag(readVarint(bytes_));
+        }
+
+        bool atEnd() const { return remaining_ == 0; }
+        int  dest() const { return dest_; }
+        int  weight() const { return *weights_; }
+        Neighbor operator*() const { return Neighbor{dest_, *weights_}; }
+
+        NeighborIterator& operator++() {
+            ++weights_;
+            if (--remaining_ > 0) dest_ += static_cast<int>(readVarint(bytes_));
+            return *this;
+        }
+
+        bool operator!=(NeighborEnd) const { return remaining_ != 0; }
+    };
+
+    /// @brief begin()/end() pair for range-for.
+    struct NeighborRange {
+        NeighborIterator first;
+        NeighborIterator begin() const { return first; }
+        NeighborEnd      end() const { return NeighborEnd{}; }
+    };
+
+    /// @brief Compress the adjacency lists of g.
+    explicit CompressedGraph(const Graph& g);
+    /// @brief Compress CSR arrays, e.g. a MappedGraph view.
+    explicit CompressedGraph(const CsrView& csr);
+
+    int numVertices() const { return numVertices_; }
+    int numArcs() const { return arcOffsets_[numVertices_]; }
+    int degree(int u) const { return arcOffsets_[u + 1] - arcOffsets_[u]; }
+
+    /// @brief Neighbours of u in ascending id order, decoded lazily.
+    NeighborRange neighbors(int u) const {
+        return NeighborRange{NeighborIterator(bytes_.data() + byteOffsets_[u],
+                                              weights_.data() + arcOffsets_[u],
+                                              degree(u), u)};
+    }
+
+    /// @brief Bytes held by the encoded lists, weights and offset tables.
+    std::size_t memoryBytes() const;
+
+    /// @brief Read one LEB128 varint and advance p past it.
+    static std::uint32_t readVarint(const std::uint8_t*& p) {
+        std::uint32_t value = *p & 0x7f;
+        int shift = 7;
+        while (*p++ & 0x80) {
+            value |= static_cast<std::uint32_t>(*p & 0x7f) << shift;
+            shift += 7;
+        }
+        return value;
+    }
+
+    static int unzigzag(std::uint32_t z) {
+        return static_cast<int>(z >> 1) ^ -static_cast<int>(z & 1);
+    }
+
+private:
+    int                       numVertices_;
+    std::vector<std::size_t>  byteOffsets_;  ///< start of u's list in bytes_
+    std::vector<int>          arcOffsets_;   ///< start of u's weights; degree prefix sums
+    std::vector<std::uint8_t> bytes_;
+    std::vector<int>          weights_;
+
+    void build(SortedLists& lists);
+};
+
+}
@@ -0,0 +1,8 @@
+#include "CsrGraph.hpp"
+
+namespace graph {
+
+template struct BasicCsrGraph<int>;
+template struct BasicCsrGraph<NoWeight>;
+
+}
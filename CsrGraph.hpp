@@ -0,0 +1,101 @@
+#pragma once
+#include "graph.hpp"
+#include "Weights.hpp"
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace graph {
+
+/// @brief Non-owning view of CSR arrays, whether they live in a CsrGraph or
+/// in a mapped graph file. Same layout as CsrGraph.
+template<typename W>
+struct BasicCsrView {
+    using Weight = W;
+
+    int        numVertices;
+    const int* offsets;  ///< numVertices + 1 entries
+    const int* dests;
+    const W*   weights;  ///< nullptr for NoWeight
+
+    int numArcs() const { return offsets[numVertices]; }
+    int degree(int u) const { return offsets[u + 1] - offsets[u]; }
+};
+
+/// @brief Read-only compressed-sparse-row snapshot of a Graph.
+/// Out-edges of vertex u are stored in [offsets[u], offsets[u+1]) of
+/// dests/weights, in the same order as u's adjacency list.
+/// W is the stored weight type; Graph weights are converted on construction.
+/// With W = NoWeight (UnweightedCsrGraph) only offsets and dests are kept.
+template<typename W>
+struct BasicCsrGraph {
+    using Weight = W;
+
+    int              numVertices;
+    std::vector<int> offsets;  ///< size numVertices + 1
+    std::vector<int> dests;    ///< destination id per arc
+    std::vector<W>   weights;  ///< weight per arc; empty for NoWeight
+
+    /// @brief Snapshot the adjacency lists of g (each undirected edge gives two arcs).
+    /// @throws std::out_of_range if a weight does not fit in W
+    explicit BasicCsrGraph(const Graph& g);
+
+    /// @brief Adopt prebuilt arrays (offsets of size n + 1, arcs in list order).
+    BasicCsrGraph(int n, std::vector<int> offsets, std::vector<int> dests, std::vector<W> weights);
+
+    /// @brief Number of stored arcs.
+    int numArcs() const { return static_cast<int>(dests.size()); }
+
+    /// @brief Out-degree of vertex u.
+    int degree(int u) const { return offsets[u + 1] - offsets[u]; }
+
+    /// @brief View of this snapshot; valid while the CsrGraph is alive and unchanged.
+    BasicCsrView<W> view() const {
+        return BasicCsrView<W>{numVertices, offsets.data(), dests.data(),
+                               kHasWeights<W> ? weights.data() : nullptr};
+    }
+};
+
+using CsrView  = BasicCsrView<int>;
+using CsrGraph = BasicCsrGraph<int>;
+
+/// @brief Pure id arrays, for graphs whose weights are never read.
+using UnweightedCsrView  = BasicCsrView<NoWeight>;
+using UnweightedCsrGraph = BasicCsrGraph<NoWeight>;
+
+// Two passes over the adjacency lists: count degrees, then copy arcs.
+template<typename W>
+BasicCsrGraph<W>::BasicCsrGraph(const Graph& g)
+    : numVertices(g.numVertices), offsets(g.numVertices + 1, 0) {
+    for (int u = 0; u < numVertices; ++u) {
+        int deg = 0;
+        for (Edge* e = g.adjList[u]->edges; e; e = e->next)
+            ++deg;
+        offsets[u + 1] = offsets[u] + deg;
+    }
+    dests.resize(offsets[numVertices]);
+    if constexpr (kHasWeights<W>) weights.resize(offsets[numVertices]);
+    for (int u = 0; u < numVertices; ++u) {
+        int pos = offsets[u];
+        for (Edge* e = g.adjList[u]->edges; e; e = e->next) {
+            dests[pos] = e->dest->data;
+            if constexpr (kHasWeights<W>) weights[pos] = WeightTraits<W>::from(e->weight);
+            ++pos;
+        }
+    }
+}
+
+template<typename W>
+BasicCsrGraph<W>::BasicCsrGraph(int n, std::vector<int> offs, std::vector<int> arcDests, std::vector<W> arcWeights)
+    : numVertices(n), offsets(std::move(offs)), dests(std::move(arcDests)), weights(std::move(arcWeights)) {
+    if (n < 0 || offsets.size() != static_cast<std::size_t>(n) + 1 || offsets[0] != 0
+        || offsets[n] != static_cast<int>(dests.size())
+        || (kHasWeights<W> ? dests.size() != weights.size() : !weights.empty()))
+        throw std::invalid_argument("CsrGraph: inconsistent arrays");
+}
+
+// int weights are compiled once, in CsrGraph.cpp
+extern template struct BasicCsrGraph<int>;
+extern template struct BasicCsrGraph<NoWeight>;
+
+}
@@ -0,0 +1,104 @@
+#include "Dag.hpp"
+#include "QForAlg.hpp"
+#include <algorithm>
+#include <climits>
+#include <stdexcept>
+
+namespace qQueue = QForAlg;
+namespace st = std;
+
+namespace graph {
+
+// Kahn: repeatedly emit a vertex with no remaining incoming arcs.
+st::vector<int> topologicalSort(const Graph& g) {
+    int n = g.numVertices;
+    st::vector<int> indegree(n, 0);
+    for (int u = 0; u < n; ++u)
+        for (Edge* e = g.adjList[u]->edges; e; e = e->next)
+            ++indegree[e->dest->data];
+
+    qQueue::IntRingQueue ready(n);
+    for (int v = 0; v < n; ++v)
+        if (indegree[v] == 0)
+            ready.enqueue(v);
+
+    st::vector<int> order;
+    order.reserve(n);
+    while (!ready.is_empty()) {
+        int u = ready.dequeue();
+        order.push_back(u);
+        for (Edge* e = g.adjList[u]->edges; e; e = e->next)
+            if (--indegree[e->dest->data] == 0)
+                ready.enqueue(e->dest->data);
+    }
+    if (static_cast<int>(order.size()) != n)
+        throw st::invalid_argument("topologicalSort: graph has a cycle");
+    return order;
+}
+
+// relaxInOrder: one sweep over the topological order; `better(a, b)` says
+// whether candidate a improves on b, `unset` marks unreachable vertices.
+template<typename Better>
+static DagPaths relaxInOrder(const Graph& g, int source, long long unset, Better better) {
+    int n = g.numVertices;
+    if (source < 0 || source >= n)
+        throw st::out_of_range("dag paths: source out of range");
+    st::vector<int> order = topologicalSort(g);
+
+    DagPaths paths{st::vector<long long>(n, unset), st::vector<int>(n, -1)};
+    paths.distance[source] = 0;
+    for (int u : order) {
+        if (paths.distance[u] == unset) continue;
+        for (Edge* e = g.adjList[u]->edges; e; e = e->next) {
+            int v = e->dest->data;
+            long long alt = paths.distance[u] + e->weight;
+            if (paths.distance[v] == unset || better(alt, paths.distance[v])) {
+                paths.distance[v] = alt;
+                paths.parent[v]   = u;
+            }
+        }
+    }
+    return paths;
+}
+
+DagPaths dagShortestPaths(const Graph& g, int source) {
+    return relaxInOrder(g, source, LLONG_MAX,
+                        [](long long a, long long b) { return a < b; });
+}
+
+DagPaths dagLongestPaths(const Graph& g, int source) {
+    return relaxInOrder(g, source, LLONG_MIN,
+                        [](long long a, long long b) { return a > b; });
+}
+
+// Longest path ending at each vertex, starting anywhere (every vertex is a
+// zero-length path of its own), then walk back from the best end point.
+st::vector<int> dagCriticalPath(const Graph& g, long long& length) {
+    int n = g.numVertices;
+    st::vector<int> order = topologicalSort(g);
+    length = 0;
+    if (n == 0) return {};
+
+    st::vector<long long> best(n, 0);
+    st::vector<int> parent(n, -1);
+    for (int u : order) {
+        for (Edge* e = g.adjList[u]->edges; e; e = e->next) {
+            int v = e->dest->data;
+            long long alt = best[u] + e->weight;
+            if (alt > best[v]) {
+                best[v]   = alt;
+                parent[v] = u;
+            }
+        }
+    }
+
+    int end = static_cast<int>(st::max_element(best.begin(), best.end()) - best.begin());
+    length = best[end];
+    st::vector<int> path;
+    for (int v = end; v >= 0; v = parent[v])
+        path.push_back(v);
+    st::reverse(path.begin(), path.end());
+    return path;
+}
+
+}
@@ -0,0 +1,41 @@
+#pragma once
+#include "graph.hpp"
+#include <vector>
+
+namespace graph {
+
+/// @brief Topological order of a directed acyclic graph (Kahn's algorithm
+/// over a ring-buffer queue); ready vertices are emitted in FIFO order,
+/// seeded in ascending id. This is not the lexicographically smallest order.
+/// @return Every vertex id exactly once, each before all of its successors
+/// @throws std::invalid_argument if g contains a cycle.
+std::vector<int> topologicalSort(const Graph& g);
+
+/// @brief Single-source path lengths over a DAG.
+/// distance[v] is LLONG_MAX (shortest) or LLONG_MIN (longest) when v is not
+/// reachable; parent[v] is the predecessor on the chosen path or -1.
+struct DagPaths {
+    std::vector<long long> distance;
+    std::vector<int>       parent;
+};
+
+/// @brief Shortest paths from source in O(V + E) by relaxing arcs in
+/// topological order; negative weights are allowed.
+/// @throws std::out_of_range if source is out of range.
+/// @throws std::invalid_argument if g contains a cycle.
+DagPaths dagShortestPaths(const Graph& g, int source);
+
+/// @brief Longest (critical) paths from source in O(V + E).
+/// @throws std::out_of_range if source is out of range.
+/// @throws std::invalid_argument if g contains a cycle.
+DagPaths dagLongestPaths(const Graph& g, int source);
+
+/// @brief The heaviest path anywhere in the DAG (the critical path of a
+/// job-dependency graph), in O(V + E).
+/// @param length Set to the total weight of the returned path
+/// @return Vertex ids along the path; a single vertex when g has no arcs,
+///         empty when g has no vertices
+/// @throws std::invalid_argument if g contains a cycle.
+std::vector<int> dagCriticalPath(const Graph& g, long long& length);
+
+}
@@ -0,0 +1,234 @@
+#include "DynamicGraph.hpp"
+#include <stdexcept>
+#include <utility>
+
+namespace st = std;
+
+namespace graph {
+
+static int checkedVertices(int n) {
+    if (n < 0)
+        throw st::invalid_argument("Number of vertices cannot be negative");
+    return n;
+}
+
+static DynamicGraphOptions checkedOptions(const DynamicGraphOptions& o) {
+    if (!(o.compactRatio > 0.0 && o.compactRatio <= 1.0))
+        throw st::invalid_argument("DynamicGraph: compactRatio must be in (0, 1]");
+    if (o.minTombstones < 1 || o.batchVertices < 1)
+        throw st::invalid_argument("DynamicGraph: minTombstones and batchVertices must be positive");
+    return o;
+}
+
+DynamicGraph::DynamicGraph(int vertices, DynamicGraphOptions options)
+    : numVertices_(checkedVertices(vertices)),
+      options_(checkedOptions(options)),
+      blocks_(vertices),
+      liveArcs_(0),
+      tombstones_(0),
+      compactedBlocks_(0),
+      requested_(false),
+      running_(false),
+      stop_(false) {
+    if (options_.background)
+        worker_ = st::thread(&DynamicGraph::compactorLoop, this);
+}
+
+DynamicGraph::DynamicGraph(const Graph& g, DynamicGraphOptions options)
+    : DynamicGraph(g.numVertices, options) {
+    for (int u = 0; u < numVertices_; ++u) {
+        for (const Edge* e = g.adjList[u]->edges; e; e = e->next)
+            blocks_[u].arcs.push_back(Arc{e->dest->data, e->weight});
+        liveArcs_ += blocks_[u].arcs.size();
+    }
+}
+
+DynamicGraph::~DynamicGraph() {
+    if (worker_.joinable()) {
+        {
+            st::lock_guard<st::mutex> lock(signalMutex_);
+            stop_ = true;
+        }
+        wake_.notify_one();
+        worker_.join();
+    }
+}
+
+void DynamicGraph::checkVertex(int v) const {
+    if (v < 0 || v >= numVertices_)
+        throw st::out_of_range("Vertex index out of range");
+}
+
+void DynamicGraph::appendArc(int from, int to, int weight) {
+    blocks_[from].arcs.push_back(Arc{to, weight});
+    ++liveArcs_;
+}
+
+void DynamicGraph::addDirectedEdge(int from, int to, int weight) {
+    checkVertex(from);
+    checkVertex(to);
+    if (weight <= 0)
+        throw st::invalid_argument("Weight must be a positive integer");
+    st::unique_lock<st::shared_mutex> lock(mutex_);
+    appendArc(from, to, weight);
+}
+
+void DynamicGraph::addEdge(int u, int v, int weight) {
+    checkVertex(u);
+    checkVertex(v);
+    if (weight <= 0)
+        throw st::invalid_argument("Weight must be a positive integer");
+    st::unique_lock<st::shared_mutex> lock(mutex_);
+    appendArc(u, v, weight);
+    appendArc(v, u, weight);
+}
+
+// First live arc u -> v other than skip, or nullptr.
+DynamicGraph::Arc* DynamicGraph::findArc(int u, int v, const Arc* skip) {
+    for (Arc& a : blocks_[u].arcs)
+        if (a.dest == v && &a != skip) return &a;
+    return nullptr;
+}
+
+void DynamicGraph::markTombstone(int u, Arc& a) {
+    a.dest = kTombstone;
+    if (blocks_[u].tombstones++ == 0) dirty_.push_back(u);
+    --liveArcs_;
+    ++tombstones_;
+}
+
+bool DynamicGraph::shouldCompact() const {
+    return tombstones_ >= static_cast<st::size_t>(options_.minTombstones)
+        && static_cast<double>(tombstones_) > options_.compactRatio * (liveArcs_ + tombstones_);
+}
+
+void DynamicGraph::removeEdge(int u, int v) {
+    checkVertex(u);
+    checkVertex(v);
+    bool trigger;
+    {
+        st::unique_lock<st::shared_mutex> lock(mutex_);
+        // a self-loop u-u is stored as two arcs in u's block
+        Arc* forward = findArc(u, v, nullptr);
+        Arc* backward = forward ? findArc(v, u, forward) : nullptr;
+        if (!backward)
+            throw st::runtime_error("Edge does not exist");
+        markTombstone(u, *forward);
+        markTombstone(v, *backward);
+        trigger = shouldCompact();
+        if (trigger && !options_.background) {
+            for (int w : dirty_) compactBlock(w);
+            dirty_.clear();
+        }
+    }
+    if (trigger && options_.background)
+        requestCompaction();
+}
+
+// Rebuild v's block without tombstones in a fresh, exactly sized array.
+void DynamicGraph::compactBlock(int v) {
+    Block& b = blocks_[v];
+    if (b.tombstones == 0) return;
+    st::vector<Arc> live;
+    live.reserve(b.arcs.size() - b.tombstones);
+    for (const Arc& a : b.arcs)
+        if (a.dest != kTombstone) live.push_back(a);
+    b.arcs.swap(live);
+    tombstones_ -= b.tombstones;
+    b.tombstones = 0;
+    ++compactedBlocks_;
+}
+
+void DynamicGraph::compact() {
+    st::unique_lock<st::shared_mutex> lock(mutex_);
+    for (int v : dirty_) compactBlock(v);
+    dirty_.clear();
+}
+
+void DynamicGraph::requestCompaction() {
+    {
+        st::lock_guard<st::mutex> lock(signalMutex_);
+        requested_ = true;
+    }
+    wake_.notify_one();
+}
+
+// Worker: on each request, drain the dirty list a batch at a time so
+// readers and writers get the lock between batches.
+void DynamicGraph::compactorLoop() {
+    st::unique_lock<st::mutex> signal(signalMutex_);
+    for (;;) {
+        wake_.wait(signal, [this]() { return stop_ || requested_; });
+        if (stop_) return;
+        requested_ = false;
+        running_ = true;
+        signal.unlock();
+
+        bool more = true;
+        while (more) {
+            st::unique_lock<st::shared_mutex> lock(mutex_);
+            for (int k = 0; k < options_.batchVertices && !dirty_.empty(); ++k) {
+                compactBlock(dirty_.back());
+                dirty_.pop_back();
+            }
+            more = !dirty_.empty();
+        }
+
+        signal.lock();
+        running_ = false;
+        idle_.notify_all();
+    }
+}
+
+void DynamicGraph::waitForCompaction() {
+    if (!worker_.joinable()) return;
+    st::unique_lock<st::mutex> signal(signalMutex_);
+    idle_.wait(signal, [this]() { return !requested_ && !running_; });
+}
+
+bool DynamicGraph::hasEdge(int u, int v) const {
+    checkVertex(u);
+    checkVertex(v);
+    st::shared_lock<st::shared_mutex> lock(mutex_);
+    for (const Arc& a : blocks_[u].arcs)
+        if (a.dest == v) return true;
+    return false;
+}
+
+int DynamicGraph::weight(int u, int v) const {
+    checkVertex(u);
+    checkVertex(v);
+    st::shared_lock<st::shared_mutex> lock(mutex_);
+    for (const Arc& a : blocks_[u].arcs)
+        if (a.dest == v) return a.weight;
+    throw st::runtime_error("Edge does not exist");
+}
+
+int DynamicGraph::degree(int u) const {
+    checkVertex(u);
+    st::shared_lock<st::shared_mutex> lock(mutex_);
+    return static_cast<int>(blocks_[u].arcs.size()) - blocks_[u].tombstones;
+}
+
+st::size_t DynamicGraph::numArcs() const {
+    st::shared_lock<st::shared_mutex> lock(mutex_);
+    return liveArcs_;
+}
+
+st::size_t DynamicGraph::numTombstones() const {
+    st::shared_lock<st::shared_mutex> lock(mutex_);
+    return tombstones_;
+}
+
+double DynamicGraph::tombstoneRatio() const {
+    st::shared_lock<st::shared_mutex> lock(mutex_);
+    st::size_t stored = liveArcs_ + tombstones_;
+    return stored == 0 ? 0.0 : static_cast<double>(tombstones_) / stored;
+}
+
+st::size_t DynamicGraph::compactedBlocks() const {
+    st::shared_lock<st::shared_mutex> lock(mutex_);
+    return compactedBlocks_;
+}
+
+}
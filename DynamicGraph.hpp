@@ -0,0 +1,124 @@
+#pragma once
+#include "graph.hpp"
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <vector>
+
+namespace graph {
+
+/// @brief When and how DynamicGraph compacts its edge blocks.
+struct DynamicGraphOptions {
+    double compactRatio   = 0.25;  ///< tombstones / stored arcs that triggers compaction
+    int    minTombstones  = 1024;  ///< no compaction below this many tombstones
+    bool   background     = true;  ///< compact on a worker thread (else inside removeEdge)
+    int    batchVertices  = 256;   ///< blocks rebuilt per exclusive-lock hold (background)
+};
+
+/// @brief Undirected weighted graph for heavy edge churn.
+/// Each vertex keeps its out-arcs in one contiguous block, in insertion
+/// order. removeEdge only marks the arcs as tombstones, so no node is freed
+/// and no list is relinked; traversals skip them. Once the tombstone ratio
+/// passes options.compactRatio, the blocks holding tombstones are rebuilt
+/// without them, by a worker thread in short batches or inline.
+/// Members are safe to call from several threads: changes and compaction
+/// batches take an exclusive lock, queries and the algorithms a shared one.
+class DynamicGraph {
+public:
+    struct Arc {
+        int dest;    ///< kTombstone once removed
+        int weight;
+    };
+    static constexpr int kTombstone = -1;
+
+private:
+    struct Block {
+        std::vector<Arc> arcs;
+        int              tombstones = 0;
+    };
+
+    int                 numVertices_;
+    DynamicGraphOptions options_;
+    std::vector<Block>  blocks_;
+    std::vector<int>    dirty_;       // vertices whose block has tombstones
+    std::size_t         liveArcs_;
+    std::size_t         tombstones_;
+    std::size_t         compactedBlocks_;
+    mutable std::shared_mutex mutex_;
+
+    // compactor thread state, guarded by signalMutex_
+    std::mutex              signalMutex_;
+    std::condition_variable wake_;
+    std::condition_variable idle_;
+    bool                    requested_;
+    bool                    running_;
+    bool                    stop_;
+    std::thread             worker_;
+
+    void checkVertex(int v) const;
+    void appendArc(int from, int to, int weight);
+    Arc* findArc(int u, int v, const Arc* skip);
+    void markTombstone(int u, Arc& a);
+    bool shouldCompact() const;
+    void compactBlock(int v);
+    void requestCompaction();
+    void compactorLoop();
+
+public:
+    /// @throws std::invalid_argument if vertices < 0 or an option is out of range.
+    explicit DynamicGraph(int vertices, DynamicGraphOptions options = DynamicGraphOptions());
+
+    /// @brief Copy of g with each adjacency list in its current order.
+    explicit DynamicGraph(const Graph& g, DynamicGraphOptions options = DynamicGraphOptions());
+
+    /// @brief Stops and joins the compactor thread.
+    ~DynamicGraph();
+
+    DynamicGraph(const DynamicGraph&) = delete;
+    DynamicGraph& operator=(const DynamicGraph&) = delete;
+
+    int numVertices() const { return numVertices_; }
+
+    /// @brief Same contract as the Graph members (out_of_range / invalid_argument).
+    void addDirectedEdge(int from, int to, int weight);
+    void addEdge(int u, int v, int weight);
+
+    /// @brief Tombstone both arcs of the first live u-v edge, then trigger
+    /// compaction if the tombstone ratio calls for it.
+    /// @throws std::out_of_range for a bad index, std::runtime_error if
+    ///         there is no such edge (nothing is changed then).
+    void removeEdge(int u, int v);
+
+    bool hasEdge(int u, int v) const;
+    /// @brief Weight of a live arc u -> v; throws std::runtime_error if there is none.
+    int  weight(int u, int v) const;
+    /// @brief Live out-arcs of u.
+    int  degree(int u) const;
+
+    std::size_t numArcs() const;
+    std::size_t numTombstones() const;
+    /// @brief Tombstones / stored arcs (0 for an empty graph).
+    double      tombstoneRatio() const;
+    /// @brief Blocks rebuilt by compaction so far.
+    std::size_t compactedBlocks() const;
+
+    /// @brief Rebuild every block that holds tombstones, now, on this thread.
+    void compact();
+
+    /// @brief Block until the compactor thread has no pending work.
+    void waitForCompaction();
+
+    /// @brief Shared lock that keeps blocks from changing; hold it while
+    /// using arcsBegin/arcsEnd (the algorithm overloads take it themselves).
+    std::shared_lock<std::shared_mutex> readLock() const {
+        return std::shared_lock<std::shared_mutex>(mutex_);
+    }
+
+    /// @brief Stored arcs of u, tombstones included (dest == kTombstone).
+    const Arc* arcsBegin(int u) const { return blocks_[u].arcs.data(); }
+    const Arc* arcsEnd(int u) const { return blocks_[u].arcs.data() + blocks_[u].arcs.size(); }
+};
+
+}
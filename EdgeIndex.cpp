@@ -0,0 +1,107 @@
+#include "EdgeIndex.hpp"
+
+namespace graph {
+
+EdgeIndex::EdgeIndex(std::size_t expected) : size_(0) {
+    std::size_t cap = 16;
+    while (cap < expected * 2) cap *= 2;
+    slots_.assign(cap, Slot{0, nullptr, 0});
+}
+
+// splitmix64 finalizer: spreads (u, v) keys that differ only in low bits.
+std::size_t EdgeIndex::home(std::uint64_t key) const {
+    key ^= key >> 30;
+    key *= 0xbf58476d1ce4e5b9ULL;
+    key ^= key >> 27;
+    key *= 0x94d049bb133111ebULL;
+    key ^= key >> 31;
+    return static_cast<std::size_t>(key) & (slots_.size() - 1);
+}
+
+void EdgeIndex::grow() {
+    std::vector<Slot> old;
+    old.swap(slots_);
+    slots_.assign(old.size() * 2, Slot{0, nullptr, 0});
+    const std::size_t mask = slots_.size() - 1;
+    for (const Slot& s : old) {
+        if (!s.edge) continue;
+        std::size_t i = home(s.key);
+        while (slots_[i].edge) i = (i + 1) & mask;
+        slots_[i] = s;
+    }
+}
+
+std::size_t EdgeIndex::findSlot(std::uint64_t key) const {
+    const std::size_t mask = slots_.size() - 1;
+    for (std::size_t i = home(key); slots_[i].edge; i = (i + 1) & mask)
+        if (slots_[i].key == key)
+            return i;
+    return slots_.size();
+}
+
+EdgeIndex::Slot& EdgeIndex::entry(int u, int v, Edge* e) {
+    const std::uint64_t key = makeKey(u, v);
+    std::size_t i = findSlot(key);
+    if (i != slots_.size()) return slots_[i];
+    if ((size_ + 1) * 2 > slots_.size()) grow();
+    const std::size_t mask = slots_.size() - 1;
+    i = home(key);
+    while (slots_[i].edge) i = (i + 1) & mask;
+    slots_[i] = Slot{key, e, 0};
+    ++size_;
+    return slots_[i];
+}
+
+void EdgeIndex::pushFront(int u, int v, Edge* e) {
+    Slot& s = entry(u, v, e);
+    s.edge = e;
+    ++s.count;
+}
+
+void EdgeIndex::pushBack(int u, int v, Edge* e) {
+    ++entry(u, v, e).count;
+}
+
+Edge* EdgeIndex::find(int u, int v) const {
+    std::size_t i = findSlot(makeKey(u, v));
+    return i == slots_.size() ? nullptr : slots_[i].edge;
+}
+
+int EdgeIndex::count(int u, int v) const {
+    std::size_t i = findSlot(makeKey(u, v));
+    return i == slots_.size() ? 0 : slots_[i].count;
+}
+
+// Backward-shift deletion: pull later entries of the probe run into the
+// hole whenever their home slot does not lie cyclically in (hole, j].
+void EdgeIndex::eraseAt(std::size_t hole) {
+    const std::size_t mask = slots_.size() - 1;
+    std::size_t j = hole;
+    for (;;) {
+        j = (j + 1) & mask;
+        if (!slots_[j].edge) break;
+        std::size_t h = home(slots_[j].key);
+        bool stays = hole <= j ? (hole < h && h <= j) : (hole < h || h <= j);
+        if (stays) continue;
+        slots_[hole] = slots_[j];
+        hole = j;
+    }
+    slots_[hole] = Slot{0, nullptr, 0};
+    --size_;
+}
+
+void EdgeIndex::popFront(int u, int v, Edge* next) {
+    std::size_t i = findSlot(makeKey(u, v));
+    if (i == slots_.size()) return;
+    if (--slots_[i].count == 0) eraseAt(i);
+    else slots_[i].edge = next;
+}
+
+bool EdgeIndex::replace(int u, int v, const Edge* from, Edge* to) {
+    std::size_t i = findSlot(makeKey(u, v));
+    if (i == slots_.size() || slots_[i].edge != from) return false;
+    slots_[i].edge = to;
+    return true;
+}
+
+}
@@ -0,0 +1,65 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace graph {
+
+struct Edge;
+
+/// @brief Open-addressing hash from an arc (u, v) to its Edge node.
+/// Linear probing with backward-shift deletion (no tombstones); the table
+/// doubles whenever it would become more than half full. Parallel arcs
+/// share one entry that points at the first of them in u's list and counts
+/// them, so lookups and removals pick the same arc as a list scan.
+class EdgeIndex {
+private:
+    struct Slot {
+        std::uint64_t key;
+        Edge*         edge;   ///< first u -> v arc in u's list; nullptr marks an empty slot
+        int           count;  ///< u -> v arcs in u's list
+    };
+
+    std::vector<Slot> slots_;
+    std::size_t       size_;
+
+    static std::uint64_t makeKey(int u, int v) {
+        return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(u)) << 32)
+             | static_cast<std::uint32_t>(v);
+    }
+    std::size_t home(std::uint64_t key) const;
+    void grow();
+    void eraseAt(std::size_t i);
+    std::size_t findSlot(std::uint64_t key) const;  // slot index, or slots_.size()
+    Slot& entry(int u, int v, Edge* e);             // existing or new slot (count 0)
+
+public:
+    /// @brief Empty index sized for about `expected` distinct arcs.
+    explicit EdgeIndex(std::size_t expected = 0);
+
+    /// @brief Distinct (u, v) pairs indexed.
+    std::size_t size() const { return size_; }
+
+    /// @brief Record e as the new first u -> v arc (it was prepended to u's list).
+    void pushFront(int u, int v, Edge* e);
+
+    /// @brief Record e as a u -> v arc behind those already indexed
+    /// (used when indexing a list from front to back).
+    void pushBack(int u, int v, Edge* e);
+
+    /// @brief First node of arc u -> v in u's list, or nullptr.
+    Edge* find(int u, int v) const;
+
+    /// @brief Number of parallel u -> v arcs.
+    int count(int u, int v) const;
+
+    /// @brief The first u -> v arc was removed; `next` is the new first one
+    /// (nullptr if it was the last). Does nothing if u -> v is not indexed.
+    void popFront(int u, int v, Edge* next);
+
+    /// @brief Re-point the entry of arc u -> v from node `from` to node `to`.
+    /// @return false if the entry does not point at `from`
+    bool replace(int u, int v, const Edge* from, Edge* to);
+};
+
+}
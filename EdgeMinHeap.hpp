@@ -1,23 +1,31 @@
-
 #pragma once
 #include "MinHeap.hpp"
 
 namespace edgeheap {
 
-// this is the HeapEdge
-struct HeapEdge {
-    int from, to, weight;
-    HeapEdge(int f, int t, int w) : from(f), to(t), weight(w) {}
+// this is the HeapEdge (W: weight type)
+template<typename W>
+struct BasicHeapEdge {
+    int from, to;
+    W weight;
+    BasicHeapEdge(int f, int t, W w) : from(f), to(t), weight(w) {}
 };
 
 // comparator  for HeapEdge
-struct EdgeCompare {
-    bool operator()(const HeapEdge& a, const HeapEdge& b) const {
+template<typename W>
+struct BasicEdgeCompare {
+    bool operator()(const BasicHeapEdge<W>& a, const BasicHeapEdge<W>& b) const {
         return a.weight < b.weight;
     }
 };
 
 // alias the MinHeap<HeapEdge,EdgeCompare>
-using EdgeMinHeap = MinHeap<HeapEdge, EdgeCompare>;
+template<typename W>
+using BasicEdgeMinHeap = MinHeap<BasicHeapEdge<W>, BasicEdgeCompare<W>>;
+
+// int-weighted names
+using HeapEdge    = BasicHeapEdge<int>;
+using EdgeCompare = BasicEdgeCompare<int>;
+using EdgeMinHeap = BasicEdgeMinHeap<int>;
 
-}
\ No newline at end of file
+}
@@ -0,0 +1,128 @@
+#include "FloydWarshall.hpp"
+#include "Parallel.hpp"
+#include <algorithm>
+#include <climits>
+#include <stdexcept>
+#include <vector>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define FW_HAVE_AVX2_KERNEL 1
+#include <immintrin.h>
+#endif
+
+namespace st = std;
+
+namespace graph {
+
+// "Infinity" inside the padded matrix: INF + INF still fits in an int, so the
+// kernels can add without saturation checks and every cell stays <= INF.
+static const int kInf = INT_MAX / 2;
+static const int B    = kFloydWarshallTile;
+
+// minPlusTile: C = min(C, A (min,+) B) for one B x B tile, k outermost.
+// C may alias A or B (phases 1 and 2): with a zero diagonal, row and column k
+// of the pivot tile are left unchanged during step k, so this stays correct.
+static void minPlusTileScalar(int* C, const int* A, const int* Bt, int stride) {
+    for (int k = 0; k < B; ++k) {
+        const int* bRow = Bt + k * stride;
+        for (int i = 0; i < B; ++i) {
+            const int aik = A[i * stride + k];
+            int* cRow = C + i * stride;
+            for (int j = 0; j < B; ++j)
+                cRow[j] = st::min(cRow[j], aik + bRow[j]);
+        }
+    }
+}
+
+#ifdef FW_HAVE_AVX2_KERNEL
+__attribute__((target("avx2")))
+static void minPlusTileAvx2(int* C, const int* A, const int* Bt, int stride) {
+    for (int k = 0; k < B; ++k) {
+        const int* bRow = Bt + k * stride;
+        for (int i = 0; i < B; ++i) {
+            const __m256i aik = _mm256_set1_epi32(A[i * stride + k]);
+            int* cRow = C + i * stride;
+            for (int j = 0; j < B; j += 8) {
+                __m256i c = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(cRow + j));
+                __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(bRow + j));
+                c = _mm256_min_epi32(c, _mm256_add_epi32(aik, b));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(cRow + j), c);
+            }
+        }
+    }
+}
+#endif
+
+using TileKernel = void (*)(int*, const int*, const int*, int);
+
+// Pick the widest kernel the running CPU supports.
+static TileKernel selectKernel() {
+#ifdef FW_HAVE_AVX2_KERNEL
+    if (__builtin_cpu_supports("avx2"))
+        return minPlusTileAvx2;
+#endif
+    return minPlusTileScalar;
+}
+
+void floydWarshall(const Graph& g, DistanceMatrix& out, int numThreads) {
+    int n = g.numVertices;
+    if (out.size() != n)
+        throw st::invalid_argument("floydWarshall: matrix size does not match graph");
+    if (numThreads < 0)
+        throw st::invalid_argument("floydWarshall: negative thread count");
+    if (n == 0) return;
+    numThreads = resolveThreadCount(numThreads);
+
+    // Export adjacency into a padded matrix; padding cells act as isolated vertices.
+    const int tiles  = (n + B - 1) / B;
+    const int stride = tiles * B;
+    st::vector<int> d(static_cast<st::size_t>(stride) * stride, kInf);
+    for (int i = 0; i < stride; ++i)
+        d[static_cast<st::size_t>(i) * stride + i] = 0;
+    for (int u = 0; u < n; ++u) {
+        int* row = &d[static_cast<st::size_t>(u) * stride];
+        for (Edge* e = g.adjList[u]->edges; e; e = e->next) {
+            if (e->weight < 0)
+                throw st::invalid_argument("floydWarshall: negative edge weight");
+            int w = st::min(e->weight, kInf);
+            if (w < row[e->dest->data]) row[e->dest->data] = w;
+        }
+    }
+
+    const TileKernel kernel = selectKernel();
+    auto tile = [&](int ti, int tj) {
+        return d.data() + static_cast<st::size_t>(ti) * B * stride + static_cast<st::size_t>(tj) * B;
+    };
+
+    for (int kb = 0; kb < tiles; ++kb) {
+        int* pivot = tile(kb, kb);
+        // Phase 1: pivot tile against itself.
+        kernel(pivot, pivot, pivot, stride);
+        // Phase 2: pivot row and pivot column.
+        parallelFor(2 * tiles, numThreads, [&](int idx) {
+            if (idx < tiles) {
+                if (idx != kb) kernel(tile(kb, idx), pivot, tile(kb, idx), stride);
+            } else {
+                int i = idx - tiles;
+                if (i != kb) kernel(tile(i, kb), tile(i, kb), pivot, stride);
+            }
+        });
+        // Phase 3: all remaining tiles are independent; split by tile row.
+        parallelFor(tiles, numThreads, [&](int i) {
+            if (i == kb) return;
+            const int* left = tile(i, kb);
+            for (int j = 0; j < tiles; ++j)
+                if (j != kb) kernel(tile(i, j), left, tile(kb, j), stride);
+        });
+    }
+
+    // Copy back, mapping the internal infinity to INT_MAX.
+    for (int i = 0; i < n; ++i) {
+        const int* src = &d[static_cast<st::size_t>(i) * stride];
+        int* dst = out.row(i);
+        for (int j = 0; j < n; ++j)
+            dst[j] = src[j] >= kInf ? INT_MAX : src[j];
+    }
+}
+
+}
@@ -0,0 +1,28 @@
+#pragma once
+#include "graph.hpp"
+#include "APSP.hpp"
+
+namespace graph {
+
+/// @brief Edge length of the square tiles processed by floydWarshall.
+/// The exported matrix is padded up to a multiple of this.
+constexpr int kFloydWarshallTile = 64;
+
+/// @brief Dense all-pairs shortest paths via cache-blocked Floyd-Warshall.
+/// The adjacency of g is exported into a padded row-major matrix and relaxed
+/// tile by tile with a min-plus kernel (AVX2 when the CPU supports it, scalar
+/// otherwise). Meant for dense graphs of up to a few thousand vertices; for
+/// sparse graphs allPairsShortestPaths is cheaper.
+/// Weights must be non-negative: unreachable cells hold INT_MAX / 2, which
+/// a negative weight would pull below "infinity". Path lengths must stay
+/// below INT_MAX / 2.
+/// @param g          Graph with non-negative weights (parallel edges keep the lightest)
+/// @param out        Preallocated matrix with out.size() == g.numVertices;
+///                   unreachable pairs are set to INT_MAX
+/// @param numThreads Threads used for the independent tiles of each round;
+///                   0 selects std::thread::hardware_concurrency()
+/// @throws std::invalid_argument if out has the wrong size, numThreads < 0
+///         or g has a negative weight (out is left unchanged).
+void floydWarshall(const Graph& g, DistanceMatrix& out, int numThreads = 1);
+
+}
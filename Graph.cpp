@@ -1,10 +1,14 @@
 
 #include "graph.hpp"
+#include "EdgeIndex.hpp"
+#include "Parallel.hpp"
 #include <stdexcept>
 #include <iostream>
 #include <iomanip>
 #include <sstream>
 #include <algorithm>
+#include <cstdint>
+#include <new>
 
 namespace st = std;
 
@@ -14,7 +18,7 @@ namespace graph {
 /// @param vertices Number of vertices; must be >= 0.
 /// @throws std::invalid_argument if vertices < 0.
 Graph::Graph(int vertices)
-    : root(nullptr), numVertices(vertices) {
+    : root(nullptr), edgeIndex(nullptr), numVertices(vertices) {
     if (vertices < 0) {
         throw st::invalid_argument("Number of vertices cannot be negative");
     }
@@ -32,12 +36,21 @@ Graph::~Graph() {
         while (current) {
             Edge* toDelete = current;
             current = current->next;
-            delete toDelete;
+            if (!toDelete->pooled) delete toDelete;
         }
         // Delete the vertex
         delete adjList[i];
     }
     delete[] adjList;
+    delete edgeIndex;
+    // Edge is trivially destructible, so bulk blocks are just freed
+    for (Edge* block : edgeBlocks)
+        operator delete[](block);
+}
+
+// Free a single edge node unless it belongs to a bulk block.
+static void releaseEdge(Edge* e) {
+    if (!e->pooled) delete e;
 }
 
 // Add a directed edge from 'from' to 'to' with given weight.
@@ -48,6 +61,7 @@ void Graph::addDirectedEdge(int from, int to, int weight) {
     Edge* newEdge = new Edge(weight, adjList[from], adjList[to]);
     newEdge->next = adjList[from]->edges;
     adjList[from]->edges = newEdge;
+    if (edgeIndex) edgeIndex->pushFront(from, to, newEdge);
 }
 
 // Add an undirected edge between two vertices with given weight.
@@ -63,11 +77,152 @@ void Graph::addEdge(int indU, int indV, int weight1) {
     addDirectedEdge(indV, indU, weight1);
 }
 
+// Bulk insert: validate, count arcs per vertex, then place and link them.
+void Graph::addEdges(const EdgeTriple* edges, st::size_t count, int numThreads) {
+    for (st::size_t i = 0; i < count; ++i) {
+        const EdgeTriple& t = edges[i];
+        if (t.u < 0 || t.u >= numVertices || t.v < 0 || t.v >= numVertices) {
+            throw st::out_of_range("Vertex index out of range");
+        }
+        if (t.weight <= 0) {
+            throw st::invalid_argument("Weight must be a positive integer");
+        }
+    }
+    if (count == 0) return;
+    const int n = numVertices;
+    const int workers = static_cast<int>(st::min<st::size_t>(resolveThreadCount(numThreads), count));
+
+    Edge* block = static_cast<Edge*>(operator new[](2 * count * sizeof(Edge)));
+    edgeBlocks.push_back(block);
+    auto place = [&](st::size_t slot, const EdgeTriple& e, int from, int to) {
+        Edge* arc = new (&block[slot]) Edge(e.weight, adjList[from], adjList[to]);
+        arc->pooled = true;
+    };
+
+    // offsets[u] ends up as the end of u's run; the run starts at offsets[u - 1]
+    // (0 for u == 0), and runs are in vertex order.
+    st::vector<st::size_t> offsets(n + 1, 0);
+    if (workers == 1) {
+        for (st::size_t i = 0; i < count; ++i) {
+            ++offsets[edges[i].u + 1];
+            ++offsets[edges[i].v + 1];
+        }
+        for (int u = 0; u < n; ++u)
+            offsets[u + 1] += offsets[u];
+        for (st::size_t i = 0; i < count; ++i) {
+            place(offsets[edges[i].u]++, edges[i], edges[i].u, edges[i].v);
+            place(offsets[edges[i].v]++, edges[i], edges[i].v, edges[i].u);
+        }
+    } else {
+        // Worker t owns the input chunk [count*t/workers, count*(t+1)/workers)
+        // and counts only the vertices that chunk touches, so the counters
+        // take O(count) memory in total rather than O(workers * n).
+        struct Touch {
+            int         vertex;
+            st::size_t  slot;  // arcs of the chunk at vertex, then the next free slot
+        };
+        st::vector<st::vector<Touch>> touched(workers);
+        // Endpoints of each chunk as (vertex << 32 | position in chunk), sorted:
+        // grouped by vertex, input order within a vertex (a chunk holds fewer
+        // than 2^31 triples, so positions fit in 32 bits).
+        st::vector<st::vector<st::uint64_t>> ends(workers);
+
+        // Pass 1: sorted endpoints and (vertex, arcs) list per chunk.
+        parallelFor(workers, workers, [&](int t) {
+            st::size_t lo = count * t / workers, hi = count * (t + 1) / workers;
+            st::vector<st::uint64_t>& keys = ends[t];
+            keys.reserve(2 * (hi - lo));
+            for (st::size_t i = lo; i < hi; ++i) {
+                st::uint64_t at = 2 * (i - lo);
+                keys.push_back(static_cast<st::uint64_t>(edges[i].u) << 32 | at);
+                keys.push_back(static_cast<st::uint64_t>(edges[i].v) << 32 | (at + 1));
+            }
+            st::sort(keys.begin(), keys.end());
+            st::vector<Touch>& list = touched[t];
+            for (st::uint64_t key : keys) {
+                int v = static_cast<int>(key >> 32);
+                if (list.empty() || list.back().vertex != v) list.push_back(Touch{v, 0});
+                ++list.back().slot;
+            }
+        });
+
+        // Walk each vertex range through the chunks in order: first to sum
+        // the degrees, then, after the prefix sum, to hand every chunk its
+        // slots, so each vertex's arcs keep input order.
+        auto eachTouch = [&](int w, auto&& fn) {
+            int lo = static_cast<int>(static_cast<long long>(n) * w / workers);
+            int hi = static_cast<int>(static_cast<long long>(n) * (w + 1) / workers);
+            for (int t = 0; t < workers; ++t) {
+                auto it = st::lower_bound(touched[t].begin(), touched[t].end(), lo,
+                                          [](const Touch& x, int v) { return x.vertex < v; });
+                for (; it != touched[t].end() && it->vertex < hi; ++it)
+                    fn(*it);
+            }
+        };
+        parallelFor(workers, workers, [&](int w) {
+            eachTouch(w, [&](Touch& x) { offsets[x.vertex + 1] += x.slot; });
+        });
+        for (int u = 0; u < n; ++u)
+            offsets[u + 1] += offsets[u];
+        parallelFor(workers, workers, [&](int w) {
+            eachTouch(w, [&](Touch& x) {
+                st::size_t arcs = x.slot;
+                x.slot = offsets[x.vertex];
+                offsets[x.vertex] += arcs;
+            });
+        });
+
+        // Pass 2: each worker constructs the arcs of its chunk in its own
+        // slots, walking its endpoints in sorted order.
+        parallelFor(workers, workers, [&](int t) {
+            st::size_t lo = count * t / workers;
+            Touch* x = touched[t].data();
+            for (st::uint64_t key : ends[t]) {
+                int v = static_cast<int>(key >> 32);
+                if (x->vertex != v) ++x;
+                st::size_t at = static_cast<st::uint32_t>(key);
+                const EdgeTriple& e = edges[lo + at / 2];
+                if (at % 2 == 0) place(x->slot++, e, e.u, e.v);
+                else             place(x->slot++, e, e.v, e.u);
+            }
+        });
+    }
+
+    // Link each vertex's run and splice it in front of its list.
+    parallelFor(n, workers, [&](int u) {
+        st::size_t first = u == 0 ? 0 : offsets[u - 1], last = offsets[u];
+        if (first == last) return;
+        for (st::size_t k = first; k + 1 < last; ++k)
+            block[k].next = &block[k + 1];
+        block[last - 1].next = adjList[u]->edges;
+        adjList[u]->edges = &block[first];
+    });
+
+    // Back to front, so each pair's entry ends at its first arc in list order.
+    if (edgeIndex) {
+        for (st::size_t k = 2 * count; k-- > 0;)
+            edgeIndex->pushFront(block[k].src->data, block[k].dest->data, &block[k]);
+    }
+}
+
+void Graph::addEdges(const st::vector<EdgeTriple>& edges, int numThreads) {
+    addEdges(edges.data(), edges.size(), numThreads);
+}
+
 // Remove an undirected edge between two vertices.
 void Graph::removeEdge(int u, int v) {
     if (u < 0 || u >= numVertices || v < 0 || v >= numVertices) {
         throw st::out_of_range("Vertex index out of range");
     }
+    if (edgeIndex) {
+        // a self-loop u-u is two arcs in u's list
+        if (u == v ? edgeIndex->count(u, u) < 2 : !edgeIndex->find(u, v) || !edgeIndex->find(v, u)) {
+            throw st::runtime_error("Edge does not exist");
+        }
+        removeIndexedArc(u, v);
+        removeIndexedArc(v, u);
+        return;
+    }
     // Remove u -> v
     bool found1 = false;
     Edge* current = adjList[u]->edges;
@@ -76,7 +231,7 @@ void Graph::removeEdge(int u, int v) {
         if (current->dest->data == v) {
             if (prev) prev->next = current->next;
             else adjList[u]->edges = current->next;
-            delete current;
+            releaseEdge(current);
             found1 = true;
             break;
         }
@@ -91,7 +246,7 @@ void Graph::removeEdge(int u, int v) {
         if (current->dest->data == u) {
             if (prev) prev->next = current->next;
             else adjList[v]->edges = current->next;
-            delete current;
+            releaseEdge(current);
             found2 = true;
             break;
         }
@@ -103,6 +258,83 @@ void Graph::removeEdge(int u, int v) {
     }
 }
 
+// Remove the first arc u -> v in u's list (the one the list scan in
+// removeEdge would take) via the index. A singly linked list cannot unlink
+// a node without its predecessor, so the successor's contents are moved
+// into the found node and the successor is freed instead, which keeps the
+// list order. Only a tail arc needs a scan for its predecessor.
+bool Graph::removeIndexedArc(int u, int v) {
+    Edge* target = edgeIndex->find(u, v);
+    if (!target) return false;
+    Edge* after;  // node now holding the arc that followed target
+    if (Edge* succ = target->next) {
+        edgeIndex->replace(u, succ->dest->data, succ, target);
+        target->weight = succ->weight;
+        target->dest   = succ->dest;
+        target->next   = succ->next;
+        releaseEdge(succ);
+        after = target;
+    } else {
+        Edge** link = &adjList[u]->edges;
+        while (*link != target) link = &(*link)->next;
+        *link = nullptr;
+        releaseEdge(target);
+        after = nullptr;
+    }
+    // Parallel u -> v arcs come later in the list; the next one becomes first.
+    Edge* next = nullptr;
+    if (edgeIndex->count(u, v) > 1)
+        for (next = after; next->dest->data != v; next = next->next) {}
+    edgeIndex->popFront(u, v, next);
+    return true;
+}
+
+// Index every existing arc; later edge changes keep it in sync.
+void Graph::enableEdgeIndex() {
+    if (edgeIndex) return;
+    int arcs = 0;
+    for (int u = 0; u < numVertices; ++u)
+        for (Edge* e = adjList[u]->edges; e; e = e->next)
+            ++arcs;
+    EdgeIndex* index = new EdgeIndex(arcs);
+    for (int u = 0; u < numVertices; ++u)
+        for (Edge* e = adjList[u]->edges; e; e = e->next)
+            index->pushBack(u, e->dest->data, e);
+    edgeIndex = index;
+}
+
+// Drop the index; lookups fall back to scanning adjacency lists.
+void Graph::disableEdgeIndex() {
+    delete edgeIndex;
+    edgeIndex = nullptr;
+}
+
+// Find an arc u -> v through the index or, without one, a list scan.
+static Edge* findArc(Vertex** adjList, const EdgeIndex* index, int u, int v) {
+    if (index) return index->find(u, v);
+    for (Edge* e = adjList[u]->edges; e; e = e->next)
+        if (e->dest->data == v) return e;
+    return nullptr;
+}
+
+bool Graph::hasEdge(int u, int v) const {
+    if (u < 0 || u >= numVertices || v < 0 || v >= numVertices) {
+        throw st::out_of_range("Vertex index out of range");
+    }
+    return findArc(adjList, edgeIndex, u, v) != nullptr;
+}
+
+int Graph::weight(int u, int v) const {
+    if (u < 0 || u >= numVertices || v < 0 || v >= numVertices) {
+        throw st::out_of_range("Vertex index out of range");
+    }
+    Edge* e = findArc(adjList, edgeIndex, u, v);
+    if (!e) {
+        throw st::runtime_error("Edge does not exist");
+    }
+    return e->weight;
+}
+
 // Print adjacency list representation to standard output.
 void Graph::print_graph() const {
     for (int i = 0; i < numVertices; ++i) {
@@ -0,0 +1,153 @@
+#include "GraphFile.hpp"
+#include <climits>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace st = std;
+
+namespace graph {
+
+static const char          kMagic[8]  = {'G', 'R', 'A', 'P', 'H', 'C', 'S', 'R'};
+static const st::uint32_t  kByteOrder = 0x01020304u;
+
+// View of an empty graph, used before mapping and after a move.
+static const int kNoArcs[1] = {0};
+static CsrView emptyView() {
+    return CsrView{0, kNoArcs, kNoArcs, kNoArcs};
+}
+
+// Bytes a file with n vertices and m arcs must have.
+static st::size_t graphFileBytes(st::int64_t n, st::int64_t m) {
+    return sizeof(GraphFileHeader)
+         + static_cast<st::size_t>(n + 1 + 2 * m) * sizeof(st::int32_t);
+}
+
+// ---------------------------------------------------------------------------
+// Writing
+// ---------------------------------------------------------------------------
+
+void writeGraphFile(const CsrView& csr, const st::string& path) {
+    GraphFileHeader header;
+    st::memcpy(header.magic, kMagic, sizeof(kMagic));
+    header.version     = kGraphFileVersion;
+    header.byteOrder   = kByteOrder;
+    header.numVertices = csr.numVertices;
+    header.numArcs     = csr.numArcs();
+
+    st::ofstream out(path, st::ios::binary | st::ios::trunc);
+    if (!out)
+        throw st::runtime_error("writeGraphFile: cannot open " + path);
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    out.write(reinterpret_cast<const char*>(csr.offsets),
+              static_cast<st::streamsize>((csr.numVertices + 1) * sizeof(int)));
+    out.write(reinterpret_cast<const char*>(csr.dests),
+              static_cast<st::streamsize>(header.numArcs * sizeof(int)));
+    out.write(reinterpret_cast<const char*>(csr.weights),
+              static_cast<st::streamsize>(header.numArcs * sizeof(int)));
+    out.flush();
+    if (!out)
+        throw st::runtime_error("writeGraphFile: cannot write " + path);
+}
+
+void writeGraphFile(const Graph& g, const st::string& path) {
+    CsrGraph csr(g);
+    writeGraphFile(csr.view(), path);
+}
+
+// ---------------------------------------------------------------------------
+// MappedGraph
+// ---------------------------------------------------------------------------
+
+MappedGraph::MappedGraph(const st::string& path)
+    : base_(nullptr), bytes_(0), view_(emptyView()) {
+#if defined(_WIN32)
+    (void)path;
+    throw st::runtime_error("MappedGraph: memory-mapped files are not supported on this platform");
+#else
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+        throw st::runtime_error("MappedGraph: cannot open " + path);
+    struct stat info;
+    if (::fstat(fd, &info) != 0) {
+        ::close(fd);
+        throw st::runtime_error("MappedGraph: cannot stat " + path);
+    }
+    if (static_cast<st::size_t>(info.st_size) < sizeof(GraphFileHeader)) {
+        ::close(fd);
+        throw st::runtime_error("MappedGraph: " + path + " is too short for a graph file");
+    }
+    bytes_ = static_cast<st::size_t>(info.st_size);
+    void* p = ::mmap(nullptr, bytes_, PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (p == MAP_FAILED)
+        throw st::runtime_error("MappedGraph: cannot map " + path);
+    base_ = p;
+
+    // Only the header and the two offset sentinels are read here; the arrays
+    // themselves are paged in on first use.
+    const GraphFileHeader* header = static_cast<const GraphFileHeader*>(base_);
+    const char* problem = nullptr;
+    if (st::memcmp(header->magic, kMagic, sizeof(kMagic)) != 0)
+        problem = "not a graph file";
+    else if (header->version != kGraphFileVersion)
+        problem = "unsupported format version";
+    else if (header->byteOrder != kByteOrder)
+        problem = "written with a different byte order";
+    else if (header->numVertices < 0 || header->numVertices >= INT_MAX
+             || header->numArcs < 0 || header->numArcs > INT_MAX)
+        problem = "counts out of range";
+    else if (bytes_ != graphFileBytes(header->numVertices, header->numArcs))
+        problem = "size does not match header";
+    if (!problem) {
+        const int* offsets = reinterpret_cast<const int*>(header + 1);
+        int n = static_cast<int>(header->numVertices);
+        int m = static_cast<int>(header->numArcs);
+        if (offsets[0] != 0 || offsets[n] != m) {
+            problem = "inconsistent offsets";
+        } else {
+            view_ = CsrView{n, offsets, offsets + n + 1, offsets + n + 1 + m};
+        }
+    }
+    if (problem) {
+        ::munmap(base_, bytes_);
+        base_ = nullptr;
+        throw st::runtime_error("MappedGraph: " + path + ": " + problem);
+    }
+#endif
+}
+
+MappedGraph::~MappedGraph() {
+#if !defined(_WIN32)
+    if (base_) ::munmap(base_, bytes_);
+#endif
+}
+
+MappedGraph::MappedGraph(MappedGraph&& other) noexcept
+    : base_(other.base_), bytes_(other.bytes_), view_(other.view_) {
+    other.base_ = nullptr;
+    other.bytes_ = 0;
+    other.view_ = emptyView();
+}
+
+MappedGraph& MappedGraph::operator=(MappedGraph&& other) noexcept {
+    if (this != &other) {
+        MappedGraph old(st::move(*this));
+        base_ = other.base_;
+        bytes_ = other.bytes_;
+        view_ = other.view_;
+        other.base_ = nullptr;
+        other.bytes_ = 0;
+        other.view_ = emptyView();
+    }
+    return *this;
+}
+
+}
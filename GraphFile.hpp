@@ -0,0 +1,65 @@
+#pragma once
+#include "graph.hpp"
+#include "CsrGraph.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace graph {
+
+/// @brief Current version of the binary graph format.
+constexpr std::uint32_t kGraphFileVersion = 1;
+
+/// @brief Fixed 32-byte header at offset 0 of a graph file.
+/// It is followed by three native-endian int32 arrays, with no padding:
+/// offsets[numVertices + 1], dests[numArcs], weights[numArcs].
+/// That is the CsrGraph layout, so a mapped file is used in place.
+struct GraphFileHeader {
+    char          magic[8];     ///< "GRAPHCSR"
+    std::uint32_t version;      ///< kGraphFileVersion
+    std::uint32_t byteOrder;    ///< 0x01020304 as written by the producer
+    std::int64_t  numVertices;
+    std::int64_t  numArcs;
+};
+
+static_assert(sizeof(GraphFileHeader) == 32, "graph file header must stay 32 bytes");
+
+/// @brief Write g to path in the binary graph format (replacing the file).
+/// Arcs keep the order of g's adjacency lists.
+/// @throws std::runtime_error if the file cannot be written.
+void writeGraphFile(const Graph& g, const std::string& path);
+
+/// @brief Write CSR arrays to path in the binary graph format.
+/// @throws std::runtime_error if the file cannot be written.
+void writeGraphFile(const CsrView& csr, const std::string& path);
+
+/// @brief Read-only graph backed by a memory-mapped graph file.
+/// Opening only maps the file and checks the header and the file size, so
+/// it takes O(1) time. Pages are loaded lazily as the algorithms touch
+/// them. Pass view() to the CsrView overloads in Algorithms.hpp.
+class MappedGraph {
+private:
+    void*       base_;
+    std::size_t bytes_;
+    CsrView     view_;
+
+public:
+    /// @brief Map the graph file at path.
+    /// @throws std::runtime_error if the file cannot be opened or mapped, or
+    ///         if its header, version, byte order or size is invalid.
+    explicit MappedGraph(const std::string& path);
+    ~MappedGraph();
+
+    MappedGraph(const MappedGraph&) = delete;
+    MappedGraph& operator=(const MappedGraph&) = delete;
+    MappedGraph(MappedGraph&& other) noexcept;
+    MappedGraph& operator=(MappedGraph&& other) noexcept;
+
+    int numVertices() const { return view_.numVertices; }
+    int numArcs() const { return view_.numArcs(); }
+
+    /// @brief CSR view into the mapping; valid while this object is alive.
+    const CsrView& view() const { return view_; }
+};
+
+}
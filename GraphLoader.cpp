@@ -0,0 +1,353 @@
+#include "GraphLoader.hpp"
+#include "Parallel.hpp"
+#include <algorithm>
+#include <chrono>
+#include <climits>
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace st = std;
+
+namespace graph {
+
+// Read-only mapping of a whole file, released on scope exit.
+class MappedText {
+public:
+    const char* data = nullptr;
+    st::size_t  size = 0;
+
+    explicit MappedText(const st::string& path) {
+#if defined(_WIN32)
+        (void)path;
+        throw st::runtime_error("loadGraph: memory-mapped files are not supported on this platform");
+#else
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0)
+            throw st::runtime_error("loadGraph: cannot open " + path);
+        struct stat info;
+        if (::fstat(fd, &info) != 0) {
+            ::close(fd);
+            throw st::runtime_error("loadGraph: cannot stat " + path);
+        }
+        size = static_cast<st::size_t>(info.st_size);
+        if (size > 0) {
+            void* p = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (p == MAP_FAILED) {
+                ::close(fd);
+                throw st::runtime_error("loadGraph: cannot map " + path);
+            }
+            ::madvise(p, size, MADV_SEQUENTIAL);
+            data = static_cast<const char*>(p);
+        }
+        ::close(fd);
+#endif
+    }
+
+    ~MappedText() {
+#if !defined(_WIN32)
+        if (data) ::munmap(const_cast<char*>(data), size);
+#endif
+    }
+
+    MappedText(const MappedText&) = delete;
+    MappedText& operator=(const MappedText&) = delete;
+};
+
+// ---------------------------------------------------------------------------
+// Scanning helpers
+// ---------------------------------------------------------------------------
+
+static inline bool isBlank(char c) {
+    return c == ' ' || c == '\t' || c == '\r';
+}
+
+static inline void skipBlanks(const char*& p, const char* end) {
+    while (p < end && isBlank(*p)) ++p;
+}
+
+static inline const char* lineEnd(const char* p, const char* end) {
+    const void* nl = st::memchr(p, '\n', static_cast<st::size_t>(end - p));
+    return nl ? static_cast<const char*>(nl) : end;
+}
+
+// Start of the line after the one ending at eol (end if there is none).
+static inline const char* nextLine(const char* eol, const char* end) {
+    return eol < end ? eol + 1 : end;
+}
+
+// parseInteger: optional sign, then decimal digits; no locale, no iostreams.
+// @return false if there are no digits or the value overflows
+static inline bool parseInteger(const char*& p, const char* end, long long& out) {
+    bool negative = false;
+    if (p < end && (*p == '-' || *p == '+')) {
+        negative = *p == '-';
+        ++p;
+    }
+    const char* digits = p;
+    long long value = 0;
+    while (p < end && static_cast<unsigned>(*p - '0') < 10u) {
+        if (value > (LLONG_MAX - 9) / 10) return false;
+        value = value * 10 + (*p - '0');
+        ++p;
+    }
+    if (p == digits) return false;
+    out = negative ? -value : value;
+    return true;
+}
+
+// Case-insensitive match of the next blank-separated word.
+static bool nextWordIs(const char*& p, const char* end, const char* word) {
+    skipBlanks(p, end);
+    st::size_t len = st::strlen(word);
+    if (static_cast<st::size_t>(end - p) < len) return false;
+    for (st::size_t i = 0; i < len; ++i)
+        if ((p[i] | 0x20) != word[i]) return false;
+    if (p + len < end && !isBlank(p[len])) return false;
+    p += len;
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+// Headers (parsed serially; they are a few lines at most)
+// ---------------------------------------------------------------------------
+
+// What the header fixes for the body parser.
+struct BodyLayout {
+    GraphFormat format;
+    const char* begin;          // first body byte
+    long long   numVertices;    // -1: take max id + 1
+    int         base;           // first vertex id (0 or 1)
+    bool        weighted;       // MatrixMarket: integer values present
+    int         headerLine;     // line number of the first body line, minus one
+};
+
+static GraphFormat detectFormat(const char* p, const char* end) {
+    if (end - p >= 14 && st::memcmp(p, "%%MatrixMarket", 14) == 0)
+        return GraphFormat::MatrixMarket;
+    for (; p < end; p = nextLine(lineEnd(p, end), end)) {
+        const char* q = p;
+        skipBlanks(q, end);
+        if (q == end || *q == '\n') continue;
+        if (*q == 'c' || *q == 'p') return GraphFormat::Dimacs;
+        return GraphFormat::EdgeList;
+    }
+    return GraphFormat::EdgeList;
+}
+
+[[noreturn]] static void malformed(const st::string& path, long long line, const char* what) {
+    throw st::runtime_error("loadGraph: " + path + ":" + st::to_string(line) + ": " + what);
+}
+
+static BodyLayout readHeader(GraphFormat format, const char* p, const char* end,
+                             const st::string& path) {
+    BodyLayout layout{format, p, -1, 0, true, 0};
+    if (format == GraphFormat::EdgeList)
+        return layout;
+
+    int line = 0;
+    if (format == GraphFormat::MatrixMarket) {
+        layout.base = 1;
+        const char* eol = lineEnd(p, end);
+        ++line;
+        const char* q = p;
+        if (!nextWordIs(q, eol, "%%matrixmarket") || !nextWordIs(q, eol, "matrix"))
+            malformed(path, line, "missing %%MatrixMarket matrix banner");
+        if (!nextWordIs(q, eol, "coordinate"))
+            malformed(path, line, "only coordinate matrices are supported");
+        if (nextWordIs(q, eol, "pattern"))      layout.weighted = false;
+        else if (!nextWordIs(q, eol, "integer"))
+            malformed(path, line, "only pattern and integer fields are supported");
+        if (!nextWordIs(q, eol, "general") && !nextWordIs(q, eol, "symmetric"))
+            malformed(path, line, "only general and symmetric matrices are supported");
+        // comments, then "rows cols entries"
+        for (p = nextLine(eol, end); p < end; p = nextLine(eol, end)) {
+            eol = lineEnd(p, end);
+            ++line;
+            q = p;
+            skipBlanks(q, eol);
+            if (q == eol || *q == '%') continue;
+            long long rows, cols, entries;
+            if (!parseInteger(q, eol, rows) || (skipBlanks(q, eol), !parseInteger(q, eol, cols))
+                || (skipBlanks(q, eol), !parseInteger(q, eol, entries)) || rows < 0 || cols < 0)
+                malformed(path, line, "bad size line");
+            layout.numVertices = st::max(rows, cols);
+            layout.begin = nextLine(eol, end);
+            layout.headerLine = line;
+            return layout;
+        }
+        malformed(path, line, "missing size line");
+    }
+
+    // DIMACS: comment lines, then "p <kind> n m"
+    layout.base = 1;
+    for (; p < end; p = nextLine(lineEnd(p, end), end)) {
+        const char* eol = lineEnd(p, end);
+        ++line;
+        const char* q = p;
+        skipBlanks(q, eol);
+        if (q == eol || *q == 'c') continue;
+        if (*q != 'p') malformed(path, line, "expected problem line before edges");
+        ++q;
+        skipBlanks(q, eol);
+        while (q < eol && !isBlank(*q)) ++q;  // problem kind (sp, edge, ...)
+        long long n, m;
+        skipBlanks(q, eol);
+        if (!parseInteger(q, eol, n) || (skipBlanks(q, eol), !parseInteger(q, eol, m)) || n < 0)
+            malformed(path, line, "bad problem line");
+        layout.numVertices = n;
+        layout.begin = nextLine(eol, end);
+        layout.headerLine = line;
+        return layout;
+    }
+    malformed(path, line, "missing problem line");
+}
+
+// ---------------------------------------------------------------------------
+// Body chunks
+// ---------------------------------------------------------------------------
+
+struct ChunkResult {
+    st::vector<EdgeTriple> edges;
+    long long              maxId = -1;
+    const char*            error = nullptr;  // start of the first bad line
+    const char*            what  = nullptr;
+};
+
+// parseChunk: parse whole lines in [p, end) into r.edges; stops at the first bad line.
+static void parseChunk(const BodyLayout& layout, const char* p, const char* end, ChunkResult& r) {
+    const long long limit = layout.numVertices >= 0 ? layout.numVertices : INT_MAX;
+    while (p < end) {
+        const char* line = p;
+        const char* eol = lineEnd(p, end);
+        p = nextLine(eol, end);
+        const char* q = line;
+        skipBlanks(q, eol);
+        if (q == eol) continue;
+
+        bool needWeight = false, allowWeight = true;
+        switch (layout.format) {
+        case GraphFormat::MatrixMarket:
+            if (*q == '%') continue;
+            needWeight = layout.weighted;
+            allowWeight = layout.weighted;
+            break;
+        case GraphFormat::Dimacs:
+            if (*q == 'c') continue;
+            if (*q == 'a')      needWeight = true;
+            else if (*q == 'e') allowWeight = false;
+            else { r.error = line; r.what = "expected an 'a' or 'e' line"; return; }
+            ++q;
+            break;
+        default:
+            if (*q == '#' || *q == '%') continue;
+            break;
+        }
+
+        long long u, v, w = 1;
+        skipBlanks(q, eol);
+        bool ok = parseInteger(q, eol, u);
+        skipBlanks(q, eol);
+        ok = ok && parseInteger(q, eol, v);
+        skipBlanks(q, eol);
+        if (ok && allowWeight && q < eol) {
+            ok = parseInteger(q, eol, w);
+            skipBlanks(q, eol);
+        } else if (needWeight) {
+            ok = false;
+        }
+        if (!ok || q != eol) { r.error = line; r.what = "malformed edge line"; return; }
+
+        u -= layout.base;
+        v -= layout.base;
+        if (u < 0 || v < 0 || u >= limit || v >= limit) {
+            r.error = line; r.what = "vertex id out of range"; return;
+        }
+        if (w <= 0 || w > INT_MAX) {
+            r.error = line; r.what = "weight must be a positive 32-bit integer"; return;
+        }
+        r.maxId = st::max(r.maxId, st::max(u, v));
+        r.edges.push_back({static_cast<int>(u), static_cast<int>(v), static_cast<int>(w)});
+    }
+}
+
+// Bodies smaller than this per thread are not worth splitting further.
+static const st::size_t kMinChunkBytes = 1 << 16;
+
+Graph* loadGraph(const st::string& path, GraphFormat format, int numThreads, LoadStats* stats) {
+    const auto start = st::chrono::steady_clock::now();
+    int threads = resolveThreadCount(numThreads);
+    MappedText file(path);
+    const char* end = file.data + file.size;
+
+    if (format == GraphFormat::Auto)
+        format = detectFormat(file.data, end);
+    BodyLayout layout = readHeader(format, file.data, end, path);
+
+    // Split the body at line starts: boundary t moves forward past the next newline.
+    st::size_t bodyBytes = static_cast<st::size_t>(end - layout.begin);
+    int chunks = static_cast<int>(st::max<st::size_t>(1,
+                     st::min<st::size_t>(threads, bodyBytes / kMinChunkBytes)));
+    st::vector<const char*> bounds(chunks + 1, end);
+    bounds[0] = layout.begin;
+    for (int t = 1; t < chunks; ++t) {
+        const char* guess = layout.begin + bodyBytes * t / chunks;
+        guess = st::max(guess, bounds[t - 1]);
+        const char* nl = lineEnd(guess, end);
+        bounds[t] = nextLine(nl, end);
+    }
+
+    st::vector<ChunkResult> results(chunks);
+    parallelFor(chunks, threads, [&](int t) {
+        parseChunk(layout, bounds[t], bounds[t + 1], results[t]);
+    });
+
+    // First error in file order, reported with its line number
+    for (const ChunkResult& r : results) {
+        if (!r.error) continue;
+        long long line = layout.headerLine + 1
+                       + st::count(layout.begin, r.error, '\n');
+        malformed(path, line, r.what);
+    }
+
+    st::size_t total = 0;
+    long long maxId = -1;
+    for (const ChunkResult& r : results) {
+        total += r.edges.size();
+        maxId = st::max(maxId, r.maxId);
+    }
+    st::vector<EdgeTriple> edges;
+    edges.reserve(total);
+    for (ChunkResult& r : results) {
+        edges.insert(edges.end(), r.edges.begin(), r.edges.end());
+        st::vector<EdgeTriple>().swap(r.edges);
+    }
+
+    long long n = layout.numVertices >= 0 ? layout.numVertices : maxId + 1;
+    if (n > INT_MAX)
+        throw st::runtime_error("loadGraph: " + path + ": too many vertices");
+    Graph* g = new Graph(static_cast<int>(n));
+    try {
+        g->addEdges(edges, threads);
+    } catch (...) {
+        delete g;
+        throw;
+    }
+
+    if (stats) {
+        stats->bytes = file.size;
+        stats->edges = total;
+        stats->chunks = chunks;
+        stats->seconds = st::chrono::duration<double>(st::chrono::steady_clock::now() - start).count();
+    }
+    return g;
+}
+
+}
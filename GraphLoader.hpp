@@ -0,0 +1,44 @@
+#pragma once
+#include "graph.hpp"
+#include <cstddef>
+#include <string>
+
+namespace graph {
+
+/// @brief Text formats understood by loadGraph.
+enum class GraphFormat {
+    Auto,          ///< detect from the first line of the file
+    EdgeList,      ///< "u v [w]" per line, 0-based ids, '#' or '%' comments, w defaults to 1
+    MatrixMarket,  ///< "%%MatrixMarket matrix coordinate pattern|integer general|symmetric", 1-based
+    Dimacs         ///< "p <kind> n m" header, then "a u v w" or "e u v" lines, 'c' comments, 1-based
+};
+
+/// @brief Timing and size of one loadGraph call.
+struct LoadStats {
+    std::size_t bytes   = 0;    ///< file size
+    std::size_t edges   = 0;    ///< edges added to the graph
+    int         chunks  = 0;    ///< pieces the body was parsed in
+    double      seconds = 0.0;  ///< wall time from open to finished graph
+
+    /// @brief Throughput in MB/s (10^6 bytes per second).
+    double megabytesPerSecond() const {
+        return seconds > 0.0 ? static_cast<double>(bytes) / seconds / 1e6 : 0.0;
+    }
+};
+
+/// @brief Load an undirected graph from a text edge file.
+/// The file is mapped with mmap and its body is split at line boundaries
+/// into chunks. The chunks are parsed in parallel by a hand-written integer
+/// scanner, and the edges are inserted with Graph::addEdges. Every listed
+/// edge, arc or matrix entry becomes one undirected edge, so files that
+/// list both directions give parallel edges.
+/// Vertex count: max id + 1 for edge lists; from the header otherwise.
+/// @param numThreads Parser and builder threads; 0 selects hardware_concurrency()
+/// @param stats      Optional out-parameter for size and throughput
+/// @return New graph owned by the caller
+/// @throws std::runtime_error if the file cannot be read or a line is
+///         malformed (the message names the line).
+Graph* loadGraph(const std::string& path, GraphFormat format = GraphFormat::Auto,
+                 int numThreads = 0, LoadStats* stats = nullptr);
+
+}
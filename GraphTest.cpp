@@ -22,6 +22,35 @@ inline int gmtime_s(std::tm* tmDest, const time_t* sourceTime) {
 #include "MinHeap.hpp"
 #include "VertexMinHeap.hpp"
 #include "EdgeMinHeap.hpp"
+#include "IndexMinHeap.hpp"
+#include "APSP.hpp"
+#include "FloydWarshall.hpp"
+#include "MultiSourceBfs.hpp"
+#include "Traversal.hpp"
+#include "Components.hpp"
+#include "Dag.hpp"
+#include "TreeAnalytics.hpp"
+#include "GraphFile.hpp"
+#include "GraphLoader.hpp"
+#include "CompressedGraph.hpp"
+#include "StreamVByte.hpp"
+#include "StreamVByteGraph.hpp"
+#include "Reorder.hpp"
+#include "VersionedGraph.hpp"
+#include "DynamicGraph.hpp"
+#include "IncrementalSssp.hpp"
+#include "CsrGraph.hpp"
+#include <fstream>
+#include <algorithm>
+#include <queue>
+#include <vector>
+#include <climits>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <mutex>
+#include <thread>
 
 namespace gr = graph;
 namespace vertexHeap = vertexheap;
@@ -48,6 +77,38 @@ static int vertexDegree(const gr::Graph& g, int u) {
     return d;
 }
 
+/// @brief Reference hop distances from s (-1 when unreachable)
+static std::vector<int> hopDistances(const gr::Graph& g, int s) {
+    std::vector<int> d(g.numVertices, -1);
+    std::queue<int> q;
+    d[s] = 0;
+    q.push(s);
+    while (!q.empty()) {
+        int u = q.front();
+        q.pop();
+        for (gr::Edge* e = g.adjList[u]->edges; e; e = e->next)
+            if (d[e->dest->data] < 0) {
+                d[e->dest->data] = d[u] + 1;
+                q.push(e->dest->data);
+            }
+    }
+    return d;
+}
+
+/// @brief Next value in [0, 32767] from the C-library LCG; each test keeps its own seed
+static unsigned nextRandom(unsigned& seed) {
+    seed = seed * 1103515245u + 12345u;
+    return (seed >> 16) & 0x7fff;
+}
+
+/// @brief True if g stores an edge u -> v
+static bool adjacent(const gr::Graph& g, int u, int v) {
+    for (gr::Edge* e = g.adjList[u]->edges; e; e = e->next)
+        if (e->dest->data == v)
+            return true;
+    return false;
+}
+
 TEST_CASE("Graph constructor and basic properties") {
     // empty graph has correct vertex count and no edges
     gr::Graph g(5);
@@ -86,6 +147,540 @@ TEST_CASE("Add and remove edges: valid & invalid") {
     CHECK_THROWS_AS(g.removeEdge(1, 2), std::runtime_error);
 }
 
+TEST_CASE("Hash-indexed edge lookup") {
+    gr::Graph g(5);
+    g.addEdge(0, 1, 3);
+    g.addEdge(1, 2, 5);
+    // without an index lookups scan the list
+    CHECK(g.hasEdge(0, 1));
+    CHECK_FALSE(g.hasEdge(0, 2));
+    CHECK_EQ(g.weight(2, 1), 5);
+
+    g.enableEdgeIndex();
+    CHECK(g.hasEdgeIndex());
+    g.addEdge(0, 2, 7);
+    g.addEdge(0, 3, 1);
+    g.addEdge(0, 4, 2);
+    CHECK(g.hasEdge(2, 0));
+    CHECK_EQ(g.weight(0, 3), 1);
+    CHECK_THROWS_AS(g.weight(3, 4), std::runtime_error);
+    CHECK_THROWS_AS(g.hasEdge(0, 5), std::out_of_range);
+
+    // removing an arc moves its successor's contents into it
+    g.removeEdge(0, 2);
+    CHECK_FALSE(g.hasEdge(0, 2));
+    CHECK_FALSE(g.hasEdge(2, 0));
+    CHECK_EQ(g.weight(0, 4), 2);
+    CHECK_EQ(g.weight(0, 1), 3);
+    CHECK_EQ(vertexDegree(g, 0), 3);
+    CHECK_THROWS_AS(g.removeEdge(0, 2), std::runtime_error);
+
+    // parallel edges: the most recent one goes first, as without an index
+    gr::Graph p(2), q(2);
+    p.enableEdgeIndex();
+    for (gr::Graph* h : {&p, &q}) {
+        h->addEdge(0, 1, 3);
+        h->addEdge(0, 1, 5);
+        h->removeEdge(0, 1);
+    }
+    CHECK_EQ(p.weight(0, 1), 3);
+    CHECK_EQ(p.weight(1, 0), 3);
+    CHECK_EQ(q.weight(0, 1), 3);
+
+    // random churn with parallel edges and self-loops agrees with an
+    // unindexed twin, weights and list order included
+    const int n = 30;
+    gr::Graph a(n), b(n);
+    a.enableEdgeIndex();
+    unsigned seed = 8;
+    for (int step = 0; step < 2000; ++step) {
+        int u = nextRandom(seed) % n, v = nextRandom(seed) % n;
+        if (b.hasEdge(u, v) && nextRandom(seed) % 2) {
+            a.removeEdge(u, v);
+            b.removeEdge(u, v);
+        } else {
+            int w = 1 + nextRandom(seed) % 9;
+            a.addEdge(u, v, w);
+            b.addEdge(u, v, w);
+        }
+    }
+    int mismatches = 0, asymmetric = 0;
+    for (int u = 0; u < n; ++u) {
+        gr::Edge* x = a.adjList[u]->edges;
+        gr::Edge* y = b.adjList[u]->edges;
+        for (; x && y; x = x->next, y = y->next)
+            if (x->dest->data != y->dest->data || x->weight != y->weight) ++mismatches;
+        if (x || y) ++mismatches;
+        for (int v = 0; v < n; ++v) {
+            if (a.hasEdge(u, v) != b.hasEdge(u, v)) ++mismatches;
+            if (!b.hasEdge(u, v)) continue;
+            if (a.weight(u, v) != b.weight(u, v)) ++mismatches;
+            if (a.weight(u, v) != a.weight(v, u)) ++asymmetric;
+        }
+    }
+    CHECK_EQ(mismatches, 0);
+    CHECK_EQ(asymmetric, 0);
+    a.disableEdgeIndex();
+    CHECK_FALSE(a.hasEdgeIndex());
+    CHECK_EQ(::countEdges(a), ::countEdges(b));
+}
+
+TEST_CASE("Bulk edge insertion") {
+    const int n = 40;
+    std::vector<gr::EdgeTriple> batch;
+    unsigned seed = 17;
+    for (int i = 0; i < 300; ++i)
+        batch.push_back({int(nextRandom(seed) % n), int(nextRandom(seed) % n), 1 + int(nextRandom(seed) % 9)});
+
+    // same lists as repeated addEdge, new arcs first in input order
+    gr::Graph one(n), bulk(n), threaded(n);
+    one.addEdge(0, 1, 5);
+    bulk.addEdge(0, 1, 5);
+    threaded.addEdge(0, 1, 5);
+    for (auto it = batch.rbegin(); it != batch.rend(); ++it)
+        one.addEdge(it->u, it->v, it->weight);
+    bulk.addEdges(batch);
+    threaded.addEdges(batch, 4);
+    int mismatches = 0;
+    for (int u = 0; u < n; ++u) {
+        gr::Edge* a = one.adjList[u]->edges;
+        gr::Edge* b = bulk.adjList[u]->edges;
+        gr::Edge* c = threaded.adjList[u]->edges;
+        for (; a && b && c; a = a->next, b = b->next, c = c->next) {
+            if (a->dest->data != b->dest->data || a->weight != b->weight) ++mismatches;
+            if (b->dest->data != c->dest->data || b->weight != c->weight) ++mismatches;
+        }
+        if (a || b || c) ++mismatches;
+    }
+    CHECK_EQ(mismatches, 0);
+
+    // any thread count, including more threads than vertices, gives the
+    // same lists as sequential addEdge calls
+    const int small = 5;
+    std::vector<gr::EdgeTriple> dense;
+    for (int i = 0; i < 2000; ++i)
+        dense.push_back({int(nextRandom(seed) % small), int(nextRandom(seed) % small), 1 + int(nextRandom(seed) % 9)});
+    gr::Graph seq(small);
+    for (auto it = dense.rbegin(); it != dense.rend(); ++it)
+        seq.addEdge(it->u, it->v, it->weight);
+    for (int threads : {2, 3, 8, 0}) {
+        gr::Graph par(small);
+        par.addEdges(dense, threads);
+        int diffs = 0;
+        for (int u = 0; u < small; ++u) {
+            gr::Edge* a = seq.adjList[u]->edges;
+            gr::Edge* b = par.adjList[u]->edges;
+            for (; a && b; a = a->next, b = b->next)
+                if (a->dest->data != b->dest->data || a->weight != b->weight) ++diffs;
+            if (a || b) ++diffs;
+        }
+        CHECK_EQ(diffs, 0);
+    }
+
+    // a sparse batch on many vertices: each chunk touches few of them
+    const int wide = 5000;
+    std::vector<gr::EdgeTriple> sparse;
+    for (int i = 0; i < 64; ++i)
+        sparse.push_back({int(nextRandom(seed) % 40) * 97, int(nextRandom(seed) % 40) * 113,
+                          1 + int(nextRandom(seed) % 9)});
+    gr::Graph sparseSeq(wide), sparsePar(wide);
+    sparseSeq.addEdges(sparse);
+    sparsePar.addEdges(sparse, 8);
+    int sparseDiffs = 0;
+    for (int u = 0; u < wide; ++u) {
+        gr::Edge* a = sparseSeq.adjList[u]->edges;
+        gr::Edge* b = sparsePar.adjList[u]->edges;
+        for (; a && b; a = a->next, b = b->next)
+            if (a->dest->data != b->dest->data || a->weight != b->weight) ++sparseDiffs;
+        if (a || b) ++sparseDiffs;
+    }
+    CHECK_EQ(sparseDiffs, 0);
+
+    // a bad triple anywhere leaves the graph untouched
+    int before = ::countEdges(bulk);
+    CHECK_THROWS_AS(bulk.addEdges({{0, 2, 1}, {3, n, 1}}), std::out_of_range);
+    CHECK_THROWS_AS(bulk.addEdges({{0, 2, 1}, {3, 4, 0}}), std::invalid_argument);
+    CHECK_THROWS_AS(bulk.addEdges({{0, 2, 1}}, -1), std::invalid_argument);
+    CHECK_EQ(::countEdges(bulk), before);
+    bulk.addEdges(nullptr, 0);
+
+    // pooled arcs can be removed, with and without an index
+    gr::Graph g(4);
+    g.addEdges({{0, 1, 2}, {1, 2, 3}, {0, 2, 4}, {2, 3, 1}});
+    g.removeEdge(1, 2);
+    CHECK_FALSE(g.hasEdge(2, 1));
+    g.enableEdgeIndex();
+    g.addEdges({{1, 3, 6}});
+    CHECK_EQ(g.weight(3, 1), 6);
+    g.removeEdge(0, 2);
+    g.removeEdge(1, 3);
+    CHECK_FALSE(g.hasEdge(0, 2));
+    CHECK_EQ(g.weight(0, 1), 2);
+    CHECK_EQ(::countEdges(g), 2);
+}
+
+TEST_CASE("Memory-mapped graph file") {
+    const int n = 60;
+    gr::Graph g(n);
+    unsigned seed = 23;
+    for (int i = 0; i < 200; ++i) {
+        int u = nextRandom(seed) % n, v = nextRandom(seed) % n;
+        if (u != v) g.addEdge(u, v, 1 + nextRandom(seed) % 20);
+    }
+    const char* path = "graph_file_test.bin";
+    gr::writeGraphFile(g, path);
+    {
+        gr::MappedGraph mapped(path);
+        CHECK_EQ(mapped.numVertices(), n);
+        CHECK_EQ(mapped.numArcs(), 2 * ::countEdges(g));
+        gr::CsrView view = mapped.view();
+
+        // every algorithm gives the same tree on the file as on the Graph
+        gr::ResultTree a = gr::bfsTree(view, 3), b = gr::bfsTree(g, 3);
+        CHECK(a.parent == b.parent);
+        CHECK(a.order == b.order);
+        a = gr::dfsTree(view, 3);
+        b = gr::dfsTree(g, 3);
+        CHECK(a.parent == b.parent);
+        CHECK(a.order == b.order);
+        gr::ShortestPathTree c = gr::dijkstraTree(view, 3), d = gr::dijkstraTree(g, 3);
+        CHECK(c.distance == d.distance);
+        CHECK(c.parent == d.parent);
+        a = gr::primTree(view);
+        b = gr::primTree(g);
+        CHECK(a.parent == b.parent);
+        a = gr::kruskalTree(view);
+        b = gr::kruskalTree(g);
+        CHECK(a.parent == b.parent);
+        CHECK(a.weight == b.weight);
+
+        // views stay valid across a move
+        gr::MappedGraph moved(std::move(mapped));
+        CHECK_EQ(moved.view().dests[0], view.dests[0]);
+        CHECK_EQ(mapped.numArcs(), 0);
+    }
+
+    // damaged files are rejected
+    {
+        std::fstream f(path, std::ios::in | std::ios::out | std::ios::binary);
+        f.seekp(8);
+        char v = 9;
+        f.write(&v, 1);
+    }
+    CHECK_THROWS_AS(gr::MappedGraph{path}, std::runtime_error);
+    gr::writeGraphFile(g, path);
+    {
+        std::ofstream f(path, std::ios::binary | std::ios::app);
+        f.put(0);
+    }
+    CHECK_THROWS_AS(gr::MappedGraph{path}, std::runtime_error);
+    std::remove(path);
+    CHECK_THROWS_AS(gr::MappedGraph{path}, std::runtime_error);
+
+    // an empty graph round-trips too
+    gr::Graph empty(0);
+    gr::writeGraphFile(empty, path);
+    gr::MappedGraph none(path);
+    CHECK_EQ(none.numVertices(), 0);
+    CHECK_EQ(none.numArcs(), 0);
+    std::remove(path);
+}
+
+// Write text to path (binary mode, so line endings are kept as given).
+static void writeText(const char* path, const std::string& text) {
+    std::ofstream f(path, std::ios::binary | std::ios::trunc);
+    f << text;
+}
+
+TEST_CASE("Parallel edge-list loader") {
+    const char* path = "graph_loader_test.txt";
+
+    // plain edge list: comments, CRLF, optional weights, n = max id + 1
+    writeText(path, "# snap style\r\n0 1 5\r\n1\t2\n\n% other comment\n2 4 7\n");
+    gr::LoadStats stats;
+    gr::Graph* g = gr::loadGraph(path, gr::GraphFormat::Auto, 2, &stats);
+    CHECK_EQ(g->numVertices, 5);
+    CHECK_EQ(::countEdges(*g), 3);
+    CHECK_EQ(g->weight(1, 0), 5);
+    CHECK_EQ(g->weight(2, 1), 1);
+    CHECK_EQ(stats.edges, 3);
+    CHECK_GT(stats.bytes, 0);
+    delete g;
+
+    // Matrix Market, 1-based with a declared size
+    writeText(path, "%%MatrixMarket matrix coordinate integer symmetric\n% c\n6 6 2\n2 1 3\n6 4 9\n");
+    g = gr::loadGraph(path);
+    CHECK_EQ(g->numVertices, 6);
+    CHECK_EQ(g->weight(0, 1), 3);
+    CHECK_EQ(g->weight(3, 5), 9);
+    delete g;
+    writeText(path, "%%MatrixMarket matrix coordinate pattern general\n3 3 1\n1 3\n");
+    g = gr::loadGraph(path);
+    CHECK_EQ(g->weight(2, 0), 1);
+    delete g;
+
+    // DIMACS shortest-path and edge formats
+    writeText(path, "c road\np sp 4 2\na 1 2 10\nc mid\na 4 3 2\n");
+    g = gr::loadGraph(path);
+    CHECK_EQ(g->numVertices, 4);
+    CHECK_EQ(g->weight(1, 0), 10);
+    CHECK_EQ(g->weight(2, 3), 2);
+    delete g;
+    writeText(path, "p edge 3 1\ne 1 3\n");
+    g = gr::loadGraph(path, gr::GraphFormat::Dimacs);
+    CHECK(g->hasEdge(0, 2));
+    delete g;
+
+    // errors name the line
+    auto message = [&](const std::string& text) {
+        writeText(path, text);
+        try {
+            delete gr::loadGraph(path);
+        } catch (const std::runtime_error& e) {
+            return std::string(e.what());
+        }
+        return std::string();
+    };
+    CHECK_NE(message("0 1\n1 x\n").find(":2: malformed"), std::string::npos);
+    CHECK_NE(message("0 1 0\n").find(":1: weight"), std::string::npos);
+    CHECK_NE(message("p sp 2 1\na 1 3 1\n").find(":2: vertex id"), std::string::npos);
+    CHECK_NE(message("%%MatrixMarket matrix coordinate real general\n").find("integer"), std::string::npos);
+    CHECK_NE(message("%%MatrixMarket matrix coordinate integer general\n2 2 1\n1 2\n").find(":3:"), std::string::npos);
+
+    // large file: several chunks parsed in parallel give the same graph as one
+    std::string big;
+    const int n = 5000;
+    unsigned seed = 31;
+    for (int i = 0; i < 60000; ++i) {
+        big += std::to_string(nextRandom(seed) % n) + ' ' + std::to_string(nextRandom(seed) % n) + ' '
+             + std::to_string(1 + nextRandom(seed) % 100) + '\n';
+    }
+    writeText(path, big);
+    gr::Graph* one = gr::loadGraph(path, gr::GraphFormat::EdgeList, 1);
+    gr::Graph* many = gr::loadGraph(path, gr::GraphFormat::EdgeList, 4, &stats);
+    CHECK_EQ(stats.chunks, 4);
+    CHECK_EQ(stats.edges, 60000);
+    CHECK_EQ(::countEdges(*one), ::countEdges(*many));
+    int mismatches = 0;
+    for (int u = 0; u < one->numVertices; ++u) {
+        gr::Edge* a = one->adjList[u]->edges;
+        gr::Edge* b = many->adjList[u]->edges;
+        for (; a && b; a = a->next, b = b->next)
+            if (a->dest->data != b->dest->data || a->weight != b->weight) ++mismatches;
+        if (a || b) ++mismatches;
+    }
+    CHECK_EQ(mismatches, 0);
+    delete one;
+    delete many;
+    std::remove(path);
+    CHECK_THROWS_AS(gr::loadGraph(path), std::runtime_error);
+}
+
+TEST_CASE("Delta + varint compressed adjacency") {
+    // mostly local edges plus a few long jumps and a self-loop
+    const int n = 400;
+    gr::Graph g(n);
+    unsigned seed = 41;
+    for (int u = 0; u < n; ++u)
+        for (int k = 0; k < 4; ++k)
+            g.addEdge(u, (u + 1 + nextRandom(seed) % 20) % n, 1 + nextRandom(seed) % 50);
+    g.addEdge(0, n - 1, 3);
+    g.addEdge(7, 7, 2);
+    gr::CompressedGraph c(g);
+    CHECK_EQ(c.numVertices(), n);
+    CHECK_EQ(c.numArcs(), 2 * ::countEdges(g) + 2);  // countEdges skips the self-loop
+
+    // each list decodes to the sorted adjacency list
+    int mismatches = 0;
+    for (int u = 0; u < n; ++u) {
+        std::vector<std::pair<int,int>> expected, decoded;
+        for (gr::Edge* e = g.adjList[u]->edges; e; e = e->next)
+            expected.emplace_back(e->dest->data, e->weight);
+        std::sort(expected.begin(), expected.end());
+        for (gr::CompressedGraph::Neighbor nb : c.neighbors(u))
+            decoded.emplace_back(nb.dest, nb.weight);
+        if (decoded != expected) ++mismatches;
+    }
+    CHECK_EQ(mismatches, 0);
+
+    // algorithms agree with the uncompressed graph
+    gr::ResultTree b = gr::bfsTree(c, 5);
+    std::vector<int> hops(n, -1), ref = hopDistances(g, 5);
+    for (int v : b.order)
+        hops[v] = b.parent[v] < 0 ? 0 : hops[b.parent[v]] + 1;
+    CHECK(hops == ref);
+    CHECK(gr::dijkstraTree(c, 5).distance == gr::dijkstraTree(g, 5).distance);
+    gr::ResultTree p = gr::primTree(c), k = gr::kruskalTree(g);
+    long long primWeight = 0, kruskalWeight = 0;
+    for (int v = 0; v < n; ++v) {
+        primWeight += p.weight[v];
+        kruskalWeight += k.weight[v];
+    }
+    CHECK_EQ(primWeight, kruskalWeight);
+    CHECK_EQ(gr::dfsTree(c, 0).numEdges(), n - 1);
+
+    // the CSR path encodes the same bytes, and it is smaller than CSR
+    gr::CsrGraph csr(g);
+    gr::CompressedGraph fromCsr(csr.view());
+    CHECK_EQ(fromCsr.memoryBytes(), c.memoryBytes());
+    std::size_t csrBytes = (csr.offsets.size() + 2 * csr.dests.size()) * sizeof(int);
+    CHECK_LT(c.memoryBytes(), csrBytes);
+    CHECK_LT(c.memoryBytes() * 4, c.numArcs() * sizeof(gr::Edge));
+}
+
+TEST_CASE("Stream VByte codec and block-decoded adjacency") {
+    unsigned seed = 53;
+
+    // every kernel round-trips every length, including all four byte widths
+    const gr::VByteKernel kernels[] = {gr::VByteKernel::Scalar, gr::VByteKernel::Sse41,
+                                       gr::VByteKernel::Avx2, gr::VByteKernel::Auto};
+    int failures = 0;
+    for (std::size_t count = 0; count < 90; ++count) {
+        std::vector<std::uint32_t> values(count);
+        std::uint32_t x = 1000;
+        for (std::size_t i = 0; i < count; ++i) {
+            std::uint32_t gap = nextRandom(seed) % 4 == 0 ? nextRandom(seed) << (8 * (nextRandom(seed) % 3)) : nextRandom(seed) % 200;
+            values[i] = (x += gap);
+        }
+        if (count > 3) values[2] = 5;  // a negative step wraps to four bytes
+        std::vector<std::uint8_t> bytes(gr::streamVByteMaxBytes(count));
+        std::size_t used = gr::streamVByteEncodeDelta(values.data(), count, bytes.data(), 7);
+        bytes.resize(used);  // exact size, so ASan catches overreads
+        for (gr::VByteKernel k : kernels) {
+            std::vector<std::uint32_t> decoded(count + 1, 0xdeadbeef);
+            std::size_t read = gr::streamVByteDecodeDelta(bytes.data(), count, decoded.data(), 7, k);
+            if (read != used || decoded.back() != 0xdeadbeef) ++failures;
+            decoded.pop_back();
+            if (decoded != values) ++failures;
+        }
+    }
+    CHECK_EQ(failures, 0);
+    CHECK(gr::vbyteKernelSupported(gr::VByteKernel::Scalar));
+
+    // a hub with several blocks plus local edges
+    const int n = 300;
+    gr::Graph g(n);
+    for (int v = 1; v < n; v += 2)
+        g.addEdge(0, v, 1 + nextRandom(seed) % 30);
+    for (int u = 1; u < n; ++u)
+        g.addEdge(u, (u + 1 + nextRandom(seed) % 40) % n, 1 + nextRandom(seed) % 30);
+    gr::StreamVByteGraph s(g);
+    CHECK_EQ(s.numArcs(), 2 * ::countEdges(g));
+    CHECK_GT(s.degree(0), 2 * gr::kVByteBlock);
+    int mismatches = 0;
+    for (int u = 0; u < n; ++u) {
+        std::vector<std::pair<int,int>> expected, decoded;
+        for (gr::Edge* e = g.adjList[u]->edges; e; e = e->next)
+            expected.emplace_back(e->dest->data, e->weight);
+        std::sort(expected.begin(), expected.end());
+        gr::StreamVByteGraph::NeighborBlocks blocks = s.blocks(u);
+        while (blocks.next())
+            for (int i = 0; i < blocks.size(); ++i)
+                decoded.emplace_back(int(blocks.ids()[i]), blocks.weights()[i]);
+        if (decoded != expected) ++mismatches;
+    }
+    CHECK_EQ(mismatches, 0);
+
+    gr::ResultTree b = gr::bfsTree(s, 3);
+    std::vector<int> hops(n, -1), ref = hopDistances(g, 3);
+    for (int v : b.order)
+        hops[v] = b.parent[v] < 0 ? 0 : hops[b.parent[v]] + 1;
+    CHECK(hops == ref);
+    CHECK(gr::dijkstraTree(s, 3).distance == gr::dijkstraTree(g, 3).distance);
+    long long primWeight = 0, kruskalWeight = 0;
+    gr::ResultTree p = gr::primTree(s), k = gr::kruskalTree(s);
+    for (int v = 0; v < n; ++v) {
+        primWeight += p.weight[v];
+        kruskalWeight += k.weight[v];
+    }
+    CHECK_EQ(primWeight, kruskalWeight);
+}
+
+// Widest id gap over all edges after renaming v to newId[v].
+static int bandwidth(const gr::Graph& g, const std::vector<int>& newId) {
+    int width = 0;
+    for (int u = 0; u < g.numVertices; ++u)
+        for (gr::Edge* e = g.adjList[u]->edges; e; e = e->next)
+            width = std::max(width, std::abs(newId[u] - newId[e->dest->data]));
+    return width;
+}
+
+// Fraction of arcs whose endpoints end up at most `window` ids apart.
+static double shortArcFraction(const gr::Graph& g, const std::vector<int>& newId, int window) {
+    long long close = 0, arcs = 0;
+    for (int u = 0; u < g.numVertices; ++u)
+        for (gr::Edge* e = g.adjList[u]->edges; e; e = e->next, ++arcs)
+            if (std::abs(newId[u] - newId[e->dest->data]) <= window) ++close;
+    return arcs ? double(close) / arcs : 0.0;
+}
+
+TEST_CASE("Locality-improving vertex reordering") {
+    // 30 x 30 grid with scrambled ids
+    const int side = 30, n = side * side;
+    std::vector<int> scramble(n);
+    for (int v = 0; v < n; ++v) scramble[v] = v;
+    unsigned seed = 61;
+    for (int v = n - 1; v > 0; --v) {
+        std::swap(scramble[v], scramble[nextRandom(seed) % (v + 1)]);
+    }
+    gr::Graph g(n);
+    for (int r = 0; r < side; ++r)
+        for (int c = 0; c < side; ++c) {
+            int v = r * side + c;
+            if (c + 1 < side) g.addEdge(scramble[v], scramble[v + 1], 1 + (r + c) % 7);
+            if (r + 1 < side) g.addEdge(scramble[v], scramble[v + side], 1 + (r * c) % 5);
+        }
+    std::vector<int> identity(n);
+    for (int v = 0; v < n; ++v) identity[v] = v;
+
+    gr::VertexOrder rcm = gr::reverseCuthillMcKee(g);
+    gr::VertexOrder byDegree = gr::degreeOrder(g);
+    gr::VertexOrder gord = gr::gorderOrder(g);
+    CHECK_LE(bandwidth(g, rcm.newId), 2 * side);
+    CHECK_GT(bandwidth(g, identity), 10 * side);
+    CHECK_GT(shortArcFraction(g, gord.newId, 5), 0.4);
+    CHECK_LT(shortArcFraction(g, identity, 5), 0.05);
+    bool descending = true;
+    for (int k = 1; k < n; ++k)
+        descending = descending && vertexDegree(g, byDegree.oldId[k - 1]) >= vertexDegree(g, byDegree.oldId[k]);
+    CHECK(descending);
+
+    // results on the relabelled graph translate back to the original ids
+    gr::Graph* relabelled = gr::relabel(g, rcm);
+    CHECK_EQ(::countEdges(*relabelled), ::countEdges(g));
+    gr::ShortestPathTree sp = rcm.toOriginal(gr::dijkstraTree(*relabelled, rcm.toNew(5)));
+    gr::ShortestPathTree ref = gr::dijkstraTree(g, 5);
+    CHECK(sp.distance == ref.distance);
+    CHECK_EQ(sp.order.front(), 5);
+    int badParents = 0;
+    for (int v = 0; v < n; ++v)
+        if (v != 5 && (!g.hasEdge(sp.parent[v], v) || g.weight(sp.parent[v], v) != sp.weight[v]))
+            ++badParents;
+    CHECK_EQ(badParents, 0);
+    delete relabelled;
+    gr::Graph* byGorder = gr::relabel(g, gord);
+    gr::ResultTree b = gord.toOriginal(gr::bfsTree(*byGorder, gord.toNew(0)));
+    std::vector<int> hops(n, -1);
+    for (int v : b.order)
+        hops[v] = b.parent[v] < 0 ? 0 : hops[b.parent[v]] + 1;
+    CHECK(hops == hopDistances(g, 0));
+    delete byGorder;
+
+    gr::CsrGraph csr(g);
+    gr::CsrGraph reordered = gr::relabel(csr.view(), gord);
+    bool sorted = true;
+    for (int u = 0; u < n; ++u)
+        sorted = sorted && std::is_sorted(reordered.dests.begin() + reordered.offsets[u],
+                                          reordered.dests.begin() + reordered.offsets[u + 1]);
+    CHECK(sorted);
+    CHECK(gord.toOriginal(gr::dijkstraTree(reordered.view(), gord.toNew(5)).distance) == ref.distance);
+    CHECK(gr::reverseCuthillMcKee(csr.view()).oldId == rcm.oldId);
+
+    CHECK_THROWS_AS(gr::VertexOrder({0, 2, 2}), std::invalid_argument);
+    CHECK_THROWS_AS(gr::relabel(g, gr::VertexOrder({1, 0})), std::invalid_argument);
+    CHECK_THROWS_AS(gr::gorderOrder(g, 0), std::invalid_argument);
+}
+
 TEST_CASE("Union–Find operations") {
     // two unions, find roots
     gr::Graph g(3);
@@ -120,6 +715,24 @@ TEST_CASE("Queue (QForAlg) functionality") {
     CHECK(q.is_empty());
 }
 
+TEST_CASE("Ring-buffer queue (IntRingQueue)") {
+    // FIFO order survives wrap-around
+    qQueue::IntRingQueue q(3);
+    CHECK(q.is_empty());
+    CHECK_THROWS_AS(q.dequeue(), std::out_of_range);
+    q.enqueue(1);
+    q.enqueue(2);
+    CHECK_EQ(q.dequeue(), 1);
+    q.enqueue(3);
+    q.enqueue(4);
+    CHECK(q.is_full());
+    CHECK_THROWS_AS(q.enqueue(5), std::overflow_error);
+    CHECK_EQ(q.dequeue(), 2);
+    CHECK_EQ(q.dequeue(), 3);
+    CHECK_EQ(q.dequeue(), 4);
+    CHECK(q.is_empty());
+}
+
 TEST_CASE("VertexMinHeap operations") {
     // min-heap by distance
     vertexHeap::VertexMinHeap h;
@@ -144,6 +757,32 @@ TEST_CASE("VertexMinHeap operations") {
     CHECK(h.isEmpty());
 }
 
+TEST_CASE("IndexMinHeap operations") {
+    // ids keyed by an external array, decreaseKey by position
+    std::vector<int> key = {7, 3, 5, 1};
+    IndexMinHeap<int> h(4, key.data());
+    CHECK(h.isEmpty());
+    CHECK_THROWS_AS(h.extractMin(), std::runtime_error);
+    CHECK_THROWS_AS(h.decreaseKey(0), std::runtime_error);
+
+    for (int i = 0; i < 4; ++i)
+        h.insert(i);
+    CHECK_EQ(h.size(), 4);
+    CHECK(h.contains(2));
+
+    key[0] = 2;
+    h.decreaseKey(0);
+    // expect order: 3,0,1,2
+    CHECK_EQ(h.extractMin(), 3);
+    CHECK_EQ(h.extractMin(), 0);
+    CHECK_FALSE(h.contains(0));
+    key[2] = 0;
+    h.push(2);
+    CHECK_EQ(h.extractMin(), 2);
+    CHECK_EQ(h.extractMin(), 1);
+    CHECK(h.isEmpty());
+}
+
 TEST_CASE("BFS correctness") {
     // BFS tree has n-1 edges in a path graph
     gr::Graph g(5);
@@ -181,6 +820,13 @@ TEST_CASE("Dijkstra correctness") {
     gr::Graph* tree = dijkstra(g, 0);
     CHECK_EQ(::countEdges(*tree), 3);
     delete tree;
+
+    // per-vertex state is kept in the result, not in the input vertices
+    gr::ShortestPathTree sp = gr::dijkstraTree(g, 0);
+    CHECK_EQ(sp.distance[3], 5);
+    CHECK_EQ(sp.parent[2], 1);
+    CHECK_EQ(g.adjList[3]->distance, 0);
+    CHECK(g.adjList[3]->father == nullptr);
 }
 
 TEST_CASE("Prim correctness") {
@@ -209,3 +855,933 @@ TEST_CASE("Kruskal correctness") {
     CHECK_EQ(::countEdges(*mst), 3);
     delete mst;
 }
+
+TEST_CASE("All-pairs shortest paths") {
+    // every row must match a single-source Dijkstra run
+    gr::Graph g(6);
+    g.addEdge(0,1,7);
+    g.addEdge(0,2,9);
+    g.addEdge(0,5,14);
+    g.addEdge(1,2,10);
+    g.addEdge(1,3,15);
+    g.addEdge(2,3,11);
+    g.addEdge(2,5,2);
+    g.addEdge(3,4,6);
+
+    gr::DistanceMatrix wrong(5);
+    CHECK_THROWS_AS(gr::allPairsShortestPaths(g, wrong), std::invalid_argument);
+
+    gr::DistanceMatrix dist(6);
+    int lastReported = 0;
+    gr::allPairsShortestPaths(g, dist, 3, [&](int done, int total) {
+        CHECK_EQ(total, 6);
+        lastReported = std::max(lastReported, done);
+    });
+    CHECK_EQ(lastReported, 6);
+
+    for (int s = 0; s < 6; ++s) {
+        gr::ShortestPathTree sp = gr::dijkstraTree(g, s);
+        for (int v = 0; v < 6; ++v)
+            CHECK_EQ(dist.at(s, v), sp.distance[v]);
+    }
+    CHECK_EQ(dist.at(0, 4), 26);
+    CHECK_EQ(dist.at(4, 0), 26);
+
+    // unreachable pairs and file-backed storage
+    gr::Graph h(3);
+    h.addEdge(0,1,4);
+    const char* path = "apsp_matrix_test.bin";
+    {
+        gr::DistanceMatrix mapped(3, path);
+        CHECK(mapped.isMapped());
+        gr::allPairsShortestPaths(h, mapped, 1);
+        mapped.sync();
+        CHECK_EQ(mapped.at(1, 0), 4);
+        CHECK_EQ(mapped.at(0, 2), INT_MAX);
+        CHECK_EQ(mapped.at(2, 2), 0);
+    }
+    std::remove(path);
+}
+
+TEST_CASE("Blocked Floyd-Warshall matches per-source Dijkstra") {
+    // 150 vertices spans several tiles and a padded border
+    const int n = 150;
+    gr::Graph g(n);
+    unsigned seed = 12345;
+    for (int i = 0; i < 600; ++i) {
+        int u = nextRandom(seed) % n, v = nextRandom(seed) % n;
+        if (u != v) g.addEdge(u, v, 1 + nextRandom(seed) % 50);
+    }
+    g.addDirectedEdge(0, 149, 1000);  // one-way arc
+
+    gr::DistanceMatrix expected(n);
+    gr::allPairsShortestPaths(g, expected, 2);
+
+    for (int threads : {1, 3}) {
+        gr::DistanceMatrix dist(n);
+        gr::floydWarshall(g, dist, threads);
+        int mismatches = 0;
+        for (int i = 0; i < n; ++i)
+            for (int j = 0; j < n; ++j)
+                if (dist.at(i, j) != expected.at(i, j)) ++mismatches;
+        CHECK_EQ(mismatches, 0);
+    }
+
+    gr::Graph h(3);
+    h.addEdge(0, 1, 5);
+    gr::DistanceMatrix small(3);
+    gr::floydWarshall(h, small);
+    CHECK_EQ(small.at(1, 0), 5);
+    CHECK_EQ(small.at(0, 2), INT_MAX);
+
+    gr::DistanceMatrix wrong(2);
+    CHECK_THROWS_AS(gr::floydWarshall(h, wrong), std::invalid_argument);
+
+    // a negative weight is rejected rather than making 0 -> 2 look reachable
+    h.addDirectedEdge(2, 1, -3);
+    CHECK_THROWS_AS(gr::floydWarshall(h, small), std::invalid_argument);
+    CHECK_EQ(small.at(0, 2), INT_MAX);
+}
+
+TEST_CASE("Multi-source bit-parallel BFS") {
+    // 300 sources: one full 256-lane batch and one single-word batch
+    const int n = 120;
+    gr::Graph g(n);
+    unsigned seed = 777;
+    for (int i = 0; i < 200; ++i) {
+        int u = nextRandom(seed) % n, v = nextRandom(seed) % n;
+        if (u != v) g.addEdge(u, v, 1);
+    }
+    g.addDirectedEdge(5, 119, 1);
+
+    std::vector<int> sources;
+    for (int i = 0; i < 300; ++i)
+        sources.push_back((i * 37) % n);
+
+    std::vector<int> dist = gr::multiSourceBfs(g, sources);
+    REQUIRE_EQ(dist.size(), sources.size() * n);
+    int mismatches = 0;
+    for (std::size_t i = 0; i < sources.size(); ++i) {
+        std::vector<int> ref = hopDistances(g, sources[i]);
+        for (int v = 0; v < n; ++v)
+            if (dist[i * n + v] != ref[v]) ++mismatches;
+    }
+    CHECK_EQ(mismatches, 0);
+
+    CHECK(gr::multiSourceBfs(g, {}).empty());
+    CHECK_THROWS_AS(gr::multiSourceBfs(g, {0, n}), std::out_of_range);
+}
+
+TEST_CASE("Bidirectional BFS") {
+    const int n = 200;
+    gr::Graph g(n);
+    unsigned seed = 4242;
+    for (int i = 0; i < 260; ++i) {
+        int u = nextRandom(seed) % n, v = nextRandom(seed) % n;
+        if (u != v) g.addEdge(u, v, 1 + nextRandom(seed) % 9);
+    }
+
+    CHECK_THROWS_AS(gr::bidirectionalBfs(g, 0, n), std::out_of_range);
+    gr::HopPath self = gr::bidirectionalBfs(g, 3, 3);
+    CHECK_EQ(self.hops, 0);
+    CHECK_EQ(self.path.size(), 1);
+
+    int mismatches = 0, badPaths = 0;
+    for (int s = 0; s < n; s += 13) {
+        std::vector<int> ref = hopDistances(g, s);
+        for (int t = 0; t < n; t += 7) {
+            gr::HopPath r = gr::bidirectionalBfs(g, s, t);
+            if (r.hops != ref[t]) ++mismatches;
+            if (r.hops < 0) {
+                if (!r.path.empty()) ++badPaths;
+                continue;
+            }
+            if ((int)r.path.size() != r.hops + 1 || r.path.front() != s || r.path.back() != t)
+                ++badPaths;
+            for (std::size_t i = 1; i < r.path.size(); ++i)
+                if (!adjacent(g, r.path[i-1], r.path[i])) ++badPaths;
+        }
+    }
+    CHECK_EQ(mismatches, 0);
+    CHECK_EQ(badPaths, 0);
+
+    // one reused workspace gives the same answers as fresh ones
+    gr::BidirectionalWorkspace ws(n);
+    int reuseMismatches = 0;
+    for (int s = 0; s < n; s += 11)
+        for (int t = n - 1; t >= 0; t -= 17) {
+            gr::HopPath a = gr::bidirectionalBfs(g, s, t, ws);
+            gr::HopPath b = gr::bidirectionalBfs(g, s, t);
+            if (a.hops != b.hops || a.path != b.path) ++reuseMismatches;
+        }
+    CHECK_EQ(reuseMismatches, 0);
+    gr::BidirectionalWorkspace wrong(n + 1);
+    CHECK_THROWS_AS(gr::bidirectionalBfs(g, 0, 1, wrong), std::invalid_argument);
+}
+
+TEST_CASE("Depth-bounded and budgeted traversals") {
+    // path 0-1-2-3-4-5 plus a branch 1-6
+    gr::Graph g(7);
+    for (int i = 0; i < 5; ++i)
+        g.addEdge(i, i+1, 1);
+    g.addEdge(1, 6, 1);
+
+    gr::TraversalLimits twoHops;
+    twoHops.maxDepth = 2;
+    std::vector<int> near = gr::boundedBfs(g, 0, twoHops);
+    CHECK_EQ(near.size(), 4);   // 0, 1, 2, 6
+    for (int v : near)
+        CHECK(hopDistances(g, 0)[v] <= 2);
+
+    gr::TraversalLimits budget;
+    budget.maxVisited = 3;
+    CHECK_EQ(gr::boundedBfs(g, 0, budget).size(), 3);
+    CHECK_EQ(gr::boundedDfs(g, 0, budget).size(), 3);
+
+    gr::TraversalLimits none;
+    CHECK_EQ(gr::boundedBfs(g, 0, none).size(), 7);
+    std::vector<int> pre = gr::boundedDfs(g, 0, none);
+    CHECK_EQ(pre.size(), 7);
+    CHECK_EQ(pre.front(), 0);
+
+    gr::TraversalLimits zeroDepth;
+    zeroDepth.maxDepth = 0;
+    CHECK_EQ(gr::boundedDfs(g, 3, zeroDepth), std::vector<int>{3});
+
+    // a shared workspace gives the same answers across repeated queries
+    gr::TraversalWorkspace ws(7);
+    for (int round = 0; round < 3; ++round) {
+        CHECK_EQ(gr::boundedBfs(g, 0, twoHops, ws), near);
+        CHECK_EQ(gr::boundedDfs(g, 5, twoHops, ws).size(), 3);  // 5, 4, 3
+    }
+
+    gr::TraversalWorkspace wrong(3);
+    CHECK_THROWS_AS(gr::boundedBfs(g, 0, none, wrong), std::invalid_argument);
+    CHECK_THROWS_AS(gr::boundedDfs(g, 7, none), std::out_of_range);
+}
+
+TEST_CASE("Parallel connected components") {
+    const int n = 500;
+    gr::Graph g(n);
+    unsigned seed = 99;
+    for (int i = 0; i < 420; ++i) {
+        int u = nextRandom(seed) % n, v = nextRandom(seed) % n;
+        if (u != v) g.addEdge(u, v, 1);
+    }
+
+    // expected label: smallest id reachable from each vertex
+    std::vector<int> expected(n, -1);
+    for (int v = 0; v < n; ++v) {
+        if (expected[v] >= 0) continue;
+        std::vector<int> d = hopDistances(g, v);
+        for (int u = 0; u < n; ++u)
+            if (d[u] >= 0) expected[u] = v;
+    }
+
+    for (int threads : {1, 4}) {
+        std::vector<int> labels = gr::connectedComponents(g, threads);
+        CHECK_EQ(labels, expected);
+    }
+
+    gr::Graph empty(0);
+    CHECK(gr::connectedComponents(empty).empty());
+    CHECK_THROWS_AS(gr::connectedComponents(g, -1), std::invalid_argument);
+}
+
+TEST_CASE("Iterative strongly connected components") {
+    // random directed graph checked against mutual reachability
+    const int n = 150;
+    gr::Graph g(n);
+    unsigned seed = 31337;
+    for (int i = 0; i < 220; ++i) {
+        int u = nextRandom(seed) % n, v = nextRandom(seed) % n;
+        g.addDirectedEdge(u, v, 1);
+    }
+    std::vector<int> scc = gr::stronglyConnectedComponents(g);
+    REQUIRE_EQ(scc.size(), n);
+
+    std::vector<std::vector<int>> reach(n);
+    for (int v = 0; v < n; ++v)
+        reach[v] = hopDistances(g, v);
+    int mismatches = 0, orderViolations = 0;
+    for (int u = 0; u < n; ++u)
+        for (int v = 0; v < n; ++v) {
+            bool same = reach[u][v] >= 0 && reach[v][u] >= 0;
+            if (same != (scc[u] == scc[v])) ++mismatches;
+            // sink components complete first: an arc u -> v never goes to a later id
+            if (adjacent(g, u, v) && scc[v] > scc[u]) ++orderViolations;
+        }
+    CHECK_EQ(mismatches, 0);
+    CHECK_EQ(orderViolations, 0);
+
+    // a long directed cycle would overflow a recursive DFS on small stacks
+    const int big = 200000;
+    gr::Graph ring(big);
+    for (int i = 0; i < big; ++i)
+        ring.addDirectedEdge(i, (i + 1) % big, 1);
+    std::vector<int> one = gr::stronglyConnectedComponents(ring);
+    CHECK_EQ(one.front(), 0);
+    CHECK_EQ(one.back(), 0);
+
+    gr::Graph chain(big);
+    for (int i = 0; i + 1 < big; ++i)
+        chain.addDirectedEdge(i, i + 1, 1);
+    std::vector<int> each = gr::stronglyConnectedComponents(chain);
+    CHECK_EQ(each.front(), big - 1);
+    CHECK_EQ(each.back(), 0);
+}
+
+TEST_CASE("Topological sort and DAG paths") {
+    // 0 -> 1 -> 3, 0 -> 2 -> 3, 3 -> 4, 2 -> 4
+    gr::Graph g(6);
+    g.addDirectedEdge(0, 1, 3);
+    g.addDirectedEdge(0, 2, 2);
+    g.addDirectedEdge(1, 3, 4);
+    g.addDirectedEdge(2, 3, 1);
+    g.addDirectedEdge(3, 4, 2);
+    g.addDirectedEdge(2, 4, 9);
+
+    std::vector<int> order = gr::topologicalSort(g);
+    REQUIRE_EQ(order.size(), 6);
+    std::vector<int> pos(6);
+    for (int i = 0; i < 6; ++i) pos[order[i]] = i;
+    for (int u = 0; u < 6; ++u)
+        for (gr::Edge* e = g.adjList[u]->edges; e; e = e->next)
+            CHECK(pos[u] < pos[e->dest->data]);
+
+    gr::DagPaths sp = gr::dagShortestPaths(g, 0);
+    CHECK_EQ(sp.distance[3], 3);
+    CHECK_EQ(sp.distance[4], 5);
+    CHECK_EQ(sp.parent[4], 3);
+    CHECK_EQ(sp.distance[5], LLONG_MAX);
+
+    gr::DagPaths lp = gr::dagLongestPaths(g, 0);
+    CHECK_EQ(lp.distance[3], 7);
+    CHECK_EQ(lp.distance[4], 11);
+    CHECK_EQ(lp.parent[4], 2);
+    CHECK_EQ(lp.distance[5], LLONG_MIN);
+
+    long long length = 0;
+    std::vector<int> critical = gr::dagCriticalPath(g, length);
+    CHECK_EQ(length, 11);
+    CHECK_EQ(critical, std::vector<int>{0, 2, 4});
+
+    // negative weights are fine on a DAG
+    g.addDirectedEdge(1, 4, -10);
+    CHECK_EQ(gr::dagShortestPaths(g, 0).distance[4], -7);
+
+    g.addDirectedEdge(4, 0, 1);
+    CHECK_THROWS_AS(gr::topologicalSort(g), std::invalid_argument);
+    CHECK_THROWS_AS(gr::dagShortestPaths(g, 6), std::out_of_range);
+}
+
+/// @brief Number of connected components, optionally ignoring one vertex or one edge
+static int componentCount(int n, const std::vector<std::pair<int,int>>& edges,
+                          int skipVertex, int skipEdge) {
+    gr::Graph g(n);
+    for (int i = 0; i < (int)edges.size(); ++i)
+        if (i != skipEdge && edges[i].first != skipVertex && edges[i].second != skipVertex)
+            g.addEdge(edges[i].first, edges[i].second, 1);
+    std::vector<int> labels = gr::connectedComponents(g, 1);
+    int count = 0;
+    for (int v = 0; v < n; ++v)
+        if (v != skipVertex && labels[v] == v) ++count;
+    return count;
+}
+
+TEST_CASE("Bridges, articulation points and biconnected components") {
+    // two triangles joined by the bridge 2-3, a pendant 5-6 and a doubled edge 7-8
+    std::vector<std::pair<int,int>> edges = {
+        {0,1},{1,2},{2,0},{2,3},{3,4},{4,5},{5,3},{5,6},{7,8},{7,8}};
+    const int n = 9;
+    gr::Graph g(n);
+    for (auto& e : edges) g.addEdge(e.first, e.second, 1);
+
+    gr::Biconnectivity bc = gr::analyzeBiconnectivity(g);
+    std::vector<std::pair<int,int>> bridges = bc.bridges;
+    std::sort(bridges.begin(), bridges.end());
+    CHECK_EQ(bridges, std::vector<std::pair<int,int>>{{2,3},{5,6}});
+    CHECK_EQ(bc.articulationPoints, std::vector<int>{2,3,5});
+    CHECK_EQ(bc.components.size(), 5);  // two triangles, two bridges, the doubled edge
+
+    // random graph against brute-force removal
+    const int m = 40;
+    std::vector<std::pair<int,int>> rnd;
+    unsigned seed = 2024;
+    for (int i = 0; i < 55; ++i) {
+        int u = nextRandom(seed) % m, v = nextRandom(seed) % m;
+        if (u != v) rnd.push_back({std::min(u, v), std::max(u, v)});
+    }
+    gr::Graph r(m);
+    for (auto& e : rnd) r.addEdge(e.first, e.second, 1);
+    gr::Biconnectivity rb = gr::analyzeBiconnectivity(r);
+
+    int base = componentCount(m, rnd, -1, -1);
+    std::vector<int> cuts;
+    for (int v = 0; v < m; ++v) {
+        bool isolated = true;
+        for (auto& e : rnd) if (e.first == v || e.second == v) isolated = false;
+        if (!isolated && componentCount(m, rnd, v, -1) > base) cuts.push_back(v);
+    }
+    CHECK_EQ(rb.articulationPoints, cuts);
+
+    int bridgeCount = 0;
+    for (int i = 0; i < (int)rnd.size(); ++i)
+        if (componentCount(m, rnd, -1, i) > base) ++bridgeCount;
+    CHECK_EQ((int)rb.bridges.size(), bridgeCount);
+
+    std::size_t blockEdges = 0;
+    for (auto& block : rb.components) blockEdges += block.size();
+    CHECK_EQ(blockEdges, rnd.size());
+}
+
+TEST_CASE("getHeight on result trees") {
+    // path 0-1-2-3 with a branch 1-4
+    gr::Graph g(5);
+    g.addEdge(0, 1, 1);
+    g.addEdge(1, 2, 1);
+    g.addEdge(2, 3, 1);
+    g.addEdge(1, 4, 1);
+
+    gr::Graph* bfsTree = bfs(g, 0);     // directed
+    gr::Graph* dfsTree = dfs(g, 0);     // undirected
+    gr::Graph* mst = prim(g);
+    CHECK_EQ(getHeight(bfsTree->adjList[0]), 3);
+    CHECK_EQ(getHeight(dfsTree->adjList[0]), 3);
+    CHECK_EQ(getHeight(mst->adjList[1]), 2);
+    CHECK_EQ(getHeight(bfsTree->adjList[3]), 0);
+    CHECK_THROWS_AS(gr::getHeight(nullptr), std::invalid_argument);
+
+    // cycles are rejected instead of looping: a cyclic input graph, and a
+    // tree with a parallel arc back to the parent
+    gr::Graph cyclic(3);
+    cyclic.addEdge(0, 1, 1);
+    cyclic.addEdge(1, 2, 1);
+    cyclic.addEdge(2, 0, 1);
+    CHECK_THROWS_AS(gr::getHeight(cyclic.adjList[0]), std::invalid_argument);
+    gr::Graph doubled(2);
+    doubled.addEdge(0, 1, 1);
+    doubled.addEdge(0, 1, 1);
+    CHECK_THROWS_AS(gr::getHeight(doubled.adjList[0]), std::invalid_argument);
+    delete bfsTree;
+    delete dfsTree;
+    delete mst;
+}
+
+TEST_CASE("Tree analytics") {
+    // edges 0-1, 0-2, 1-3, 1-4, 2-5, 5-6 and an isolated vertex 7
+    gr::Graph g(8);
+    g.addEdge(0, 1, 2);
+    g.addEdge(0, 2, 1);
+    g.addEdge(1, 3, 4);
+    g.addEdge(1, 4, 1);
+    g.addEdge(2, 5, 3);
+    g.addEdge(5, 6, 1);
+
+    gr::Graph* tree = dfs(g, 0);
+    gr::TreeStats s = gr::analyzeTree(*tree, 0);
+    CHECK_EQ(s.height, 3);
+    CHECK_EQ(s.diameter, 5);                 // 3-1-0-2-5-6
+    CHECK_EQ(s.weightedDiameter, 11);        // 4+2+1+3+1
+    CHECK_EQ(s.subtreeSize[0], 7);
+    CHECK_EQ(s.subtreeSize[1], 3);
+    CHECK_EQ(s.subtreeSize[2], 3);
+    CHECK_EQ(s.subtreeSize[7], 0);           // isolated vertex outside the tree
+    CHECK_EQ(s.depth[6], 3);
+    CHECK_EQ(s.depth[7], -1);
+    CHECK_EQ(s.distance[3], 6);
+    CHECK_EQ(s.parent[6], 5);
+    CHECK_EQ(s.order.size(), 7);
+    delete tree;
+
+    gr::Graph* sp = dijkstra(g, 3);          // directed tree rooted at 3
+    CHECK_EQ(gr::analyzeTree(*sp, 3).height, 5);  // 3-1-0-2-5-6
+    delete sp;
+
+    CHECK_THROWS_AS(gr::analyzeTree(g, 8), std::out_of_range);
+    g.addEdge(3, 4, 1);
+    CHECK_THROWS_AS(gr::analyzeTree(g, 0), std::invalid_argument);
+
+    // deep path: no recursion anywhere
+    const int big = 300000;
+    gr::Graph path(big);
+    for (int i = 0; i + 1 < big; ++i)
+        path.addEdge(i, i + 1, 1);
+    gr::TreeStats deep = gr::analyzeTree(path, 0);
+    CHECK_EQ(deep.height, big - 1);
+    CHECK_EQ(deep.diameter, big - 1);
+    CHECK_EQ(gr::getHeight(path.adjList[big / 2]), big / 2);  // both directions
+}
+
+TEST_CASE("LCA and bottleneck queries on an MST") {
+    const int n = 120;
+    gr::Graph g(n);
+    unsigned seed = 5150;
+    for (int i = 0; i < 400; ++i) {
+        int u = nextRandom(seed) % n, v = nextRandom(seed) % n;
+        if (u != v) g.addEdge(u, v, 1 + nextRandom(seed) % 100);
+    }
+    gr::Graph* mst = kruskal(g);
+    gr::TreePathQuery q(*mst);
+
+    // brute force: walk the unique tree path with a parent-tracking BFS
+    int mismatches = 0;
+    for (int s = 0; s < n; s += 11) {
+        std::vector<int> par(n, -1), pw(n, 0);
+        std::vector<bool> seen(n, false);
+        std::queue<int> bq;
+        bq.push(s);
+        seen[s] = true;
+        while (!bq.empty()) {
+            int u = bq.front(); bq.pop();
+            for (gr::Edge* e = mst->adjList[u]->edges; e; e = e->next)
+                if (!seen[e->dest->data]) {
+                    seen[e->dest->data] = true;
+                    par[e->dest->data] = u;
+                    pw[e->dest->data] = e->weight;
+                    bq.push(e->dest->data);
+                }
+        }
+        for (int t = 0; t < n; ++t) {
+            if (!seen[t]) {
+                if (q.connected(s, t) || q.lca(s, t) != -1) ++mismatches;
+                continue;
+            }
+            long long len = 0;
+            int hops = 0, heaviest = INT_MIN;
+            for (int v = t; v != s; v = par[v]) {
+                len += pw[v];
+                heaviest = std::max(heaviest, pw[v]);
+                ++hops;
+            }
+            if (q.pathLength(s, t) != len || q.pathHops(s, t) != hops || q.maxEdge(s, t) != heaviest)
+                ++mismatches;
+        }
+    }
+    CHECK_EQ(mismatches, 0);
+    delete mst;
+
+    // directed BFS tree keeps its source as the root
+    gr::Graph p(6);
+    p.addEdge(0, 1, 1);
+    p.addEdge(1, 2, 1);
+    p.addEdge(1, 3, 1);
+    p.addEdge(3, 4, 1);
+    gr::Graph* tree = bfs(p, 2);
+    gr::TreePathQuery tq(*tree);
+    CHECK_EQ(tq.depth(2), 0);
+    CHECK_EQ(tq.lca(0, 4), 1);
+    CHECK_EQ(tq.lca(4, 3), 3);
+    CHECK_EQ(tq.maxEdge(4, 4), INT_MIN);
+    CHECK_EQ(tq.lca(0, 5), -1);
+    CHECK_THROWS_AS(tq.pathLength(0, 5), std::invalid_argument);
+    CHECK_THROWS_AS(tq.lca(0, 6), std::out_of_range);
+    delete tree;
+
+    gr::TreePathQuery rooted(p, 4);
+    CHECK_EQ(rooted.lca(0, 2), 1);
+    CHECK_EQ(rooted.depth(0), 3);
+}
+
+TEST_CASE("Value-returning result trees") {
+    gr::Graph g(6);
+    g.addEdge(0, 1, 4);
+    g.addEdge(0, 2, 3);
+    g.addEdge(1, 2, 1);
+    g.addEdge(1, 3, 2);
+    g.addEdge(3, 4, 7);
+
+    gr::ResultTree b = gr::bfsTree(g, 0);
+    CHECK(b.directed);
+    CHECK_EQ(b.numEdges(), 4);
+    CHECK_EQ(b.parent[0], -1);
+    CHECK_EQ(b.parent[3], 1);
+    CHECK_EQ(b.parent[5], -1);   // unreached
+    CHECK_EQ(b.order.front(), 0);
+    CHECK_EQ(b.order.size(), 5);
+
+    gr::ShortestPathTree sp = gr::dijkstraTree(g, 0);
+    CHECK_EQ(sp.distance[1], 4);
+    CHECK_EQ(sp.distance[3], 6);
+    CHECK_EQ(sp.distance[4], 13);
+    CHECK_EQ(sp.distance[5], LLONG_MAX);
+    CHECK_EQ(sp.parent[4], 3);
+    CHECK_EQ(sp.weight[4], 7);
+
+    gr::ResultTree p = gr::primTree(g);
+    gr::ResultTree k = gr::kruskalTree(g);
+    CHECK_FALSE(k.directed);
+    long long primWeight = 0, kruskalWeight = 0;
+    for (int v = 0; v < 6; ++v) {
+        primWeight += p.weight[v];
+        kruskalWeight += k.weight[v];
+    }
+    CHECK_EQ(primWeight, 13);
+    CHECK_EQ(kruskalWeight, 13);
+    CHECK_EQ(k.numEdges(), 4);
+
+    // toGraph matches the Graph-returning API
+    gr::Graph* viaTree = b.toGraph();
+    gr::Graph* direct = bfs(g, 0);
+    CHECK_EQ(::countEdges(*viaTree), ::countEdges(*direct));
+    for (int v = 0; v < 6; ++v)
+        CHECK_EQ(vertexDegree(*viaTree, v), vertexDegree(*direct, v));
+    delete viaTree;
+    delete direct;
+
+    // results are movable values
+    gr::ResultTree moved = std::move(k);
+    CHECK_EQ(moved.numEdges(), 4);
+
+    // dfs no longer recurses per vertex
+    const int big = 300000;
+    gr::Graph path(big);
+    for (int i = 0; i + 1 < big; ++i)
+        path.addEdge(i, i + 1, 1);
+    gr::ResultTree deep = gr::dfsTree(path, 0);
+    CHECK_EQ(deep.numEdges(), big - 1);
+    CHECK_EQ(deep.parent[big - 1], big - 2);
+}
+
+TEST_CASE("Generic weight types") {
+    gr::Graph g(6);
+    g.addEdge(0, 1, 4);
+    g.addEdge(0, 2, 1);
+    g.addEdge(2, 1, 2);
+    g.addEdge(1, 3, 5);
+    g.addEdge(3, 4, 3);
+
+    // narrow weights give the same trees as int weights
+    gr::BasicCsrGraph<std::uint16_t> narrow(g);
+    gr::CsrGraph wide(g);
+    gr::BasicShortestPathTree<std::uint16_t> sn = gr::dijkstraTree(narrow.view(), 0);
+    gr::ShortestPathTree sw = gr::dijkstraTree(wide.view(), 0);
+    CHECK(sn.distance == sw.distance);
+    CHECK(sn.parent == sw.parent);
+    CHECK_EQ(sn.distance[4], 11);
+    CHECK_EQ(sn.distance[5], LLONG_MAX);
+    CHECK(gr::primTree(narrow.view()).parent == gr::primTree(wide.view()).parent);
+    CHECK(gr::kruskalTree(narrow.view()).parent == gr::kruskalTree(wide.view()).parent);
+    CHECK(gr::dfsTree(narrow.view(), 0).order == gr::dfsTree(wide.view(), 0).order);
+
+    gr::Graph heavy(2);
+    heavy.addEdge(0, 1, 70000);
+    CHECK_THROWS_AS(gr::BasicCsrGraph<std::uint16_t>{heavy}, std::out_of_range);
+
+    // fractional weights: 0 -0.5-> 1 -0.25-> 2, and a heavier direct arc 0 -1-> 2
+    gr::BasicCsrGraph<double> frac(3, {0, 2, 4, 6}, {1, 2, 0, 2, 1, 0},
+                                   {0.5, 1.0, 0.5, 0.25, 0.25, 1.0});
+    gr::BasicShortestPathTree<double> sd = gr::dijkstraTree(frac.view(), 0);
+    CHECK_EQ(sd.distance[2], doctest::Approx(0.75));
+    CHECK_EQ(sd.parent[2], 1);
+    gr::BasicResultTree<double> mst = gr::kruskalTree(frac.view());
+    CHECK_EQ(mst.weight[0] + mst.weight[1] + mst.weight[2], doctest::Approx(0.75));
+    CHECK_EQ(gr::primTree(frac.view()).parent[2], 1);
+
+    // path lengths are summed in 64 bits: four INT_MAX arcs do not wrap
+    gr::Graph chain(5);
+    for (int i = 0; i < 4; ++i)
+        chain.addEdge(i, i + 1, INT_MAX);
+    CHECK_EQ(gr::dijkstraTree(chain, 0).distance[4], 4LL * INT_MAX);
+    gr::CsrGraph chainCsr(chain);
+    CHECK_EQ(gr::dijkstraTree(chainCsr.view(), 0).distance[4], 4LL * INT_MAX);
+    // an INT_MAX edge still joins the MST
+    CHECK_EQ(gr::primTree(chain).numEdges(), 4);
+
+    gr::BasicCsrGraph<long long> huge(2, {0, 1, 2}, {1, 0}, {1LL << 40, 1LL << 40});
+    gr::BasicResultTree<long long> hugeTree = gr::bfsTree(huge.view(), 0);
+    CHECK_EQ(hugeTree.weight[1], 1LL << 40);
+    CHECK_THROWS_AS(hugeTree.toGraph(), std::out_of_range);
+}
+
+TEST_CASE("Unweighted CSR graphs") {
+    gr::Graph g(7);
+    g.addEdge(0, 1, 9);
+    g.addEdge(0, 2, 3);
+    g.addEdge(1, 3, 4);
+    g.addEdge(2, 3, 8);
+    g.addEdge(5, 6, 2);
+
+    gr::UnweightedCsrGraph ids(g);
+    CHECK(ids.weights.empty());
+    CHECK(ids.view().weights == nullptr);
+    CHECK_EQ(ids.numArcs(), 10);
+    CHECK(ids.dests == gr::CsrGraph(g).dests);
+
+    // same trees as the weighted forms, minus the weights
+    gr::BasicResultTree<gr::NoWeight> b = gr::bfsTree(ids.view(), 0);
+    CHECK(b.weight.empty());
+    CHECK(b.parent == gr::bfsTree(g, 0).parent);
+    CHECK(b.order == gr::bfsTree(g, 0).order);
+    gr::BasicResultTree<gr::NoWeight> d = gr::dfsTree(ids.view(), 0);
+    CHECK(d.parent == gr::dfsTree(g, 0).parent);
+    CHECK(d.order == gr::dfsTree(g, 0).order);
+    CHECK_THROWS_AS(gr::bfsTree(ids.view(), 7), std::out_of_range);
+
+    // toGraph gives unit weights
+    gr::Graph* t = b.toGraph();
+    CHECK_EQ(::countEdges(*t), 3);
+    for (int v = 0; v < 7; ++v)
+        for (gr::Edge* e = t->adjList[v]->edges; e; e = e->next)
+            CHECK_EQ(e->weight, 1);
+    delete t;
+
+    CHECK(gr::connectedComponents(ids.view(), 2) == gr::connectedComponents(g, 2));
+    CHECK_EQ(gr::connectedComponents(ids.view())[6], 5);
+
+    // prebuilt arrays: weights must stay empty
+    gr::UnweightedCsrGraph tiny(2, {0, 1, 2}, {1, 0}, {});
+    CHECK_EQ(gr::bfsTree(tiny.view(), 1).parent[0], 1);
+    CHECK_THROWS_AS(gr::UnweightedCsrGraph(2, {0, 1, 2}, {1, 0}, {gr::NoWeight{}}),
+                    std::invalid_argument);
+}
+
+TEST_CASE("Versioned graph snapshots") {
+    gr::Graph base(6);
+    base.addEdge(0, 1, 2);
+    base.addEdge(1, 2, 2);
+    gr::VersionedGraph vg(base, 4);
+    CHECK_THROWS_AS(gr::VersionedGraph(3, 0), std::invalid_argument);
+
+    gr::VersionedGraph::Snapshot v0 = vg.pin();
+    CHECK_EQ(v0.version(), 0);
+    CHECK(gr::CsrGraph(base).dests == std::vector<int>(v0.view().dests, v0.view().dests + 4));
+
+    // staged changes are invisible until published
+    vg.addEdge(2, 3, 1);
+    vg.addEdges({{3, 4, 1}, {4, 5, 1}});
+    vg.removeEdge(0, 1);
+    CHECK_EQ(vg.pendingChanges(), 4);
+    CHECK_THROWS_AS(vg.addEdge(0, 6, 1), std::out_of_range);
+    CHECK_EQ(gr::bfsTree(vg.pin().view(), 0).numEdges(), 2);
+
+    CHECK_EQ(vg.publish(), 1);
+    CHECK_EQ(vg.publish(), 1);  // nothing staged
+    CHECK_EQ(vg.pendingChanges(), 0);
+    {
+        gr::VersionedGraph::Snapshot v1 = vg.pin();
+        CHECK_EQ(v1.version(), 1);
+        CHECK_EQ(gr::bfsTree(v1.view(), 1).numEdges(), 4);
+        CHECK_EQ(gr::dijkstraTree(v1.view(), 1).distance[5], 5);
+    }
+
+    // the pinned old version survives until it is released
+    CHECK_EQ(vg.reclaim(), 1);
+    CHECK_EQ(gr::bfsTree(v0.view(), 0).numEdges(), 2);
+    gr::VersionedGraph::Snapshot moved = std::move(v0);
+    CHECK_FALSE(v0.pinned());
+    CHECK_EQ(vg.reclaim(), 1);
+    moved.release();
+    CHECK_EQ(vg.reclaim(), 0);
+
+    // concurrent readers never see a torn or freed version: version k of
+    // the chain below has exactly k + 1 edges
+    gr::VersionedGraph chain(200, 3);
+    chain.addEdge(0, 1, 1);
+    chain.publish();
+    std::vector<int> bad(2, 0);
+    std::vector<std::thread> readers;
+    for (int t = 0; t < 2; ++t) {
+        readers.emplace_back([&chain, &bad, t]() {
+            for (int i = 0; i < 300; ++i) {
+                gr::VersionedGraph::Snapshot s = chain.pin();
+                gr::ResultTree tree = gr::bfsTree(s.view(), 0);
+                if (tree.numEdges() != s.version() || s.view().numArcs() != 2 * s.version())
+                    ++bad[t];
+            }
+        });
+    }
+    for (int v = 1; v + 1 < 200; ++v) {
+        chain.addEdge(v, v + 1, 1);
+        chain.publish();
+    }
+    for (std::thread& r : readers) r.join();
+    CHECK_EQ(bad[0] + bad[1], 0);
+    CHECK_EQ(chain.reclaim(), 0);
+    CHECK_EQ(gr::bfsTree(chain.pin().view(), 0).numEdges(), 199);
+}
+
+TEST_CASE("Dynamic graph with tombstones") {
+    gr::DynamicGraphOptions eager;
+    eager.background = false;
+    eager.minTombstones = 6;
+    eager.compactRatio = 0.3;
+    CHECK_THROWS_AS(gr::DynamicGraph(3, gr::DynamicGraphOptions{0.0, 1, true, 1}), std::invalid_argument);
+
+    gr::DynamicGraph dg(6, eager);
+    gr::Graph ref(6);
+    const int edges[][3] = {{0, 1, 4}, {0, 2, 1}, {2, 1, 2}, {1, 3, 5}, {3, 4, 3}, {4, 5, 1}, {2, 5, 9}};
+    for (const auto& e : edges) {
+        dg.addEdge(e[0], e[1], e[2]);
+        ref.addEdge(e[0], e[1], e[2]);
+    }
+    dg.addEdge(3, 3, 1);
+    CHECK_EQ(dg.numArcs(), 16);
+    CHECK_THROWS_AS(dg.addEdge(0, 6, 1), std::out_of_range);
+    CHECK_THROWS_AS(dg.addEdge(0, 1, 0), std::invalid_argument);
+
+    // removal leaves tombstones that traversals skip
+    dg.removeEdge(2, 1);
+    ref.removeEdge(2, 1);
+    dg.removeEdge(3, 3);
+    CHECK_THROWS_AS(dg.removeEdge(3, 3), std::runtime_error);
+    CHECK_THROWS_AS(dg.removeEdge(0, 5), std::runtime_error);
+    CHECK_EQ(dg.numTombstones(), 4);
+    CHECK_EQ(dg.numArcs(), 12);
+    CHECK_FALSE(dg.hasEdge(1, 2));
+    CHECK_EQ(dg.degree(2), 2);
+    CHECK_EQ(dg.weight(2, 5), 9);
+    CHECK_THROWS_AS(dg.weight(2, 1), std::runtime_error);
+    CHECK(gr::dijkstraTree(dg, 0).distance == gr::dijkstraTree(ref, 0).distance);
+    CHECK_EQ(gr::bfsTree(dg, 0).numEdges(), 5);
+    CHECK_EQ(gr::dfsTree(dg, 0).numEdges(), 5);
+    CHECK_EQ(gr::primTree(dg).numEdges(), 5);
+    gr::ResultTree k = gr::kruskalTree(dg), kr = gr::kruskalTree(ref);
+    long long kw = 0, krw = 0;
+    for (int v = 0; v < 6; ++v) { kw += k.weight[v]; krw += kr.weight[v]; }
+    CHECK_EQ(kw, krw);
+
+    // the third removal passes both thresholds: 6 of 16 stored arcs
+    dg.removeEdge(4, 5);
+    ref.removeEdge(4, 5);
+    CHECK_EQ(dg.numTombstones(), 0);
+    CHECK_GT(dg.compactedBlocks(), 0u);
+    CHECK(gr::dijkstraTree(dg, 0).distance == gr::dijkstraTree(ref, 0).distance);
+    dg.addEdge(4, 5, 2);
+    CHECK_EQ(dg.weight(5, 4), 2);
+
+    // background compaction while another thread runs traversals
+    const int n = 300;
+    unsigned seed = 7;
+    gr::Graph big(n);
+    std::vector<std::pair<int, int>> list;
+    while (list.size() < 1500) {
+        int u = nextRandom(seed) % n, v = nextRandom(seed) % n;
+        if (u == v || big.hasEdge(u, v)) continue;
+        big.addEdge(u, v, 1 + nextRandom(seed) % 20);
+        list.push_back({u, v});
+    }
+    gr::DynamicGraphOptions bgOpts;
+    bgOpts.minTombstones = 64;
+    bgOpts.batchVertices = 16;
+    gr::DynamicGraph bg(big, bgOpts);
+    CHECK(gr::dijkstraTree(bg, 0).distance == gr::dijkstraTree(big, 0).distance);
+
+    bool done = false;
+    std::mutex doneMutex;
+    int traversals = 0;
+    std::thread reader([&]() {
+        for (;;) {
+            {
+                std::lock_guard<std::mutex> lock(doneMutex);
+                if (done) return;
+            }
+            gr::bfsTree(bg, traversals % n);
+            ++traversals;
+        }
+    });
+    for (std::size_t i = 0; i < list.size(); i += 2) {
+        bg.removeEdge(list[i].first, list[i].second);
+        big.removeEdge(list[i].first, list[i].second);
+    }
+    {
+        std::lock_guard<std::mutex> lock(doneMutex);
+        done = true;
+    }
+    reader.join();
+    bg.waitForCompaction();
+    CHECK_GT(bg.compactedBlocks(), 0u);
+    CHECK(bg.tombstoneRatio() <= bgOpts.compactRatio);
+    CHECK_EQ(bg.numArcs(), 2 * 750u);
+    CHECK(gr::dijkstraTree(bg, 0).distance == gr::dijkstraTree(big, 0).distance);
+    bg.compact();
+    CHECK_EQ(bg.numTombstones(), 0);
+}
+
+TEST_CASE("Incremental shortest paths") {
+    gr::Graph g(6);
+    g.addEdge(0, 1, 4);
+    g.addEdge(0, 2, 1);
+    g.addEdge(2, 1, 2);
+    g.addEdge(1, 3, 5);
+    g.addEdge(3, 4, 3);
+    CHECK_THROWS_AS(gr::IncrementalShortestPaths(g, 6), std::out_of_range);
+
+    gr::IncrementalShortestPaths sp(g, 0);
+    CHECK(sp.distances() == gr::dijkstraTree(g, 0).distance);
+    CHECK_EQ(sp.distance(5), LLONG_MAX);
+
+    // insertion reaches 5 and touches only 5
+    CHECK_EQ(sp.addEdge(4, 5, 2), 1);
+    CHECK_EQ(sp.distance(5), 13);
+    CHECK_EQ(sp.parent(5), 4);
+    // a shortcut that improves nothing re-settles nothing
+    CHECK_EQ(sp.addEdge(0, 5, 20), 0);
+
+    // weight decrease on a non-tree edge pulls 1, 3, 4, 5 closer (2 stays at 1)
+    CHECK_EQ(sp.decreaseWeight(0, 1, 1), 4);
+    CHECK_EQ(sp.distance(5), 11);
+    CHECK_THROWS_AS(sp.decreaseWeight(0, 1, 2), std::invalid_argument);
+    CHECK_THROWS_AS(sp.decreaseWeight(0, 3, 1), std::runtime_error);
+
+    // deleting a tree edge re-settles its subtree through other edges
+    CHECK_EQ(sp.removeEdge(1, 3), 3);
+    CHECK_EQ(sp.distance(5), 20);
+    CHECK_EQ(sp.parent(3), 4);
+    CHECK_EQ(sp.removeEdge(0, 5), 3);
+    CHECK_EQ(sp.distance(3), LLONG_MAX);
+    CHECK_EQ(sp.removeEdge(0, 2), 1);  // 2 now hangs off 1
+    CHECK_EQ(sp.distance(2), 3);
+    CHECK_THROWS_AS(sp.removeEdge(0, 2), std::runtime_error);
+
+    gr::ShortestPathTree t = sp.tree();
+    CHECK_EQ(t.order.front(), 0);
+    CHECK_EQ(t.order.size(), 3);
+    CHECK_EQ(t.parent[2], 1);
+
+    // random updates agree with recomputation from scratch
+    const int n = 60;
+    unsigned seed = 11;
+    gr::Graph ref(n);
+    std::vector<std::pair<int, int>> live;
+    for (int i = 0; i < 90; ++i) {
+        int u = nextRandom(seed) % n, v = nextRandom(seed) % n;
+        if (u == v || ref.hasEdge(u, v)) continue;
+        ref.addEdge(u, v, 1 + nextRandom(seed) % 30);
+        live.push_back({u, v});
+    }
+    gr::IncrementalShortestPaths inc(ref, 0);
+    bool agree = true;
+    for (int step = 0; step < 400; ++step) {
+        int op = nextRandom(seed) % 3;
+        if (op == 0 || live.empty()) {
+            int u = nextRandom(seed) % n, v = nextRandom(seed) % n;
+            if (u == v || ref.hasEdge(u, v)) continue;
+            int w = 1 + nextRandom(seed) % 30;
+            ref.addEdge(u, v, w);
+            inc.addEdge(u, v, w);
+            live.push_back({u, v});
+        } else if (op == 1) {
+            std::pair<int, int> e = live[nextRandom(seed) % live.size()];
+            int w = ref.weight(e.first, e.second);
+            if (w == 1) continue;
+            int lower = 1 + nextRandom(seed) % (w - 1);
+            ref.removeEdge(e.first, e.second);
+            ref.addEdge(e.first, e.second, lower);
+            inc.decreaseWeight(e.first, e.second, lower);
+        } else {
+            std::size_t at = nextRandom(seed) % live.size();
+            ref.removeEdge(live[at].first, live[at].second);
+            inc.removeEdge(live[at].first, live[at].second);
+            live[at] = live.back();
+            live.pop_back();
+        }
+        gr::ShortestPathTree full = gr::dijkstraTree(ref, 0);
+        if (inc.distances() != full.distance) agree = false;
+        for (int v = 0; v < n; ++v) {
+            int p = inc.parent(v);
+            if (p >= 0 && inc.distance(p) + ref.weight(p, v) != inc.distance(v)) agree = false;
+        }
+    }
+    CHECK(agree);
+}
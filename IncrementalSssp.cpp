@@ -0,0 +1,170 @@
+#include "IncrementalSssp.hpp"
+#include <algorithm>
+#include <climits>
+#include <stdexcept>
+
+namespace st = std;
+
+namespace graph {
+
+static int checkedSource(const Graph& g, int source) {
+    if (source < 0 || source >= g.numVertices)
+        throw st::out_of_range("IncrementalShortestPaths: source out of range");
+    return source;
+}
+
+IncrementalShortestPaths::IncrementalShortestPaths(const Graph& g, int source)
+    : source_(checkedSource(g, source)),
+      adj_(g.numVertices),
+      distance_(g.numVertices, LLONG_MAX),
+      parent_(g.numVertices, -1),
+      parentWeight_(g.numVertices, 0),
+      heap_(g.numVertices, distance_.data()),
+      inAffected_(g.numVertices, false) {
+    for (int u = 0; u < g.numVertices; ++u)
+        for (const Edge* e = g.adjList[u]->edges; e; e = e->next)
+            adj_[u].push_back(Arc{e->dest->data, e->weight});
+    distance_[source_] = 0;
+    heap_.insert(source_);
+    propagate();
+}
+
+void IncrementalShortestPaths::checkVertex(int v) const {
+    if (v < 0 || v >= numVertices())
+        throw st::out_of_range("Vertex index out of range");
+}
+
+// First arc u -> v other than skip (skip separates the two arcs of a self-loop).
+IncrementalShortestPaths::Arc* IncrementalShortestPaths::findArc(int u, int v, const Arc* skip) {
+    for (Arc& a : adj_[u])
+        if (a.dest == v && &a != skip) return &a;
+    return nullptr;
+}
+
+// offer: relax arc from -> to; queue `to` if its distance dropped
+bool IncrementalShortestPaths::offer(int from, int to, int weight) {
+    if (distance_[from] == LLONG_MAX) return false;
+    long long alt = distance_[from] + weight;
+    if (alt >= distance_[to]) return false;
+    distance_[to] = alt;
+    parent_[to] = from;
+    parentWeight_[to] = weight;
+    heap_.push(to);
+    return true;
+}
+
+// propagate: Dijkstra from the queued vertices. Everything outside the queue
+// already has its final distance or a larger one, so the search stops as
+// soon as no distance improves.
+// @return Vertices settled
+int IncrementalShortestPaths::propagate() {
+    int settled = 0;
+    while (!heap_.isEmpty()) {
+        int x = heap_.extractMin();
+        ++settled;
+        for (const Arc& a : adj_[x])
+            offer(x, a.dest, a.weight);
+    }
+    return settled;
+}
+
+int IncrementalShortestPaths::addEdge(int u, int v, int weight) {
+    checkVertex(u);
+    checkVertex(v);
+    if (weight <= 0)
+        throw st::invalid_argument("Weight must be a positive integer");
+    adj_[u].push_back(Arc{v, weight});
+    adj_[v].push_back(Arc{u, weight});
+    offer(u, v, weight);
+    offer(v, u, weight);
+    return propagate();
+}
+
+int IncrementalShortestPaths::decreaseWeight(int u, int v, int newWeight) {
+    checkVertex(u);
+    checkVertex(v);
+    if (newWeight <= 0)
+        throw st::invalid_argument("Weight must be a positive integer");
+    Arc* forward = findArc(u, v, nullptr);
+    Arc* backward = forward ? findArc(v, u, forward) : nullptr;
+    if (!backward)
+        throw st::runtime_error("Edge does not exist");
+    if (newWeight > forward->weight)
+        throw st::invalid_argument("decreaseWeight: new weight is larger than the current one");
+    forward->weight = newWeight;
+    backward->weight = newWeight;
+    offer(u, v, newWeight);
+    offer(v, u, newWeight);
+    return propagate();
+}
+
+int IncrementalShortestPaths::removeEdge(int u, int v) {
+    checkVertex(u);
+    checkVertex(v);
+    Arc* forward = findArc(u, v, nullptr);
+    Arc* backward = forward ? findArc(v, u, forward) : nullptr;
+    if (!backward)
+        throw st::runtime_error("Edge does not exist");
+    const int w = forward->weight;
+    // erase the later arc first so the other pointer stays valid
+    if (u == v && backward < forward) st::swap(forward, backward);
+    adj_[v].erase(adj_[v].begin() + (backward - adj_[v].data()));
+    adj_[u].erase(adj_[u].begin() + (forward - adj_[u].data()));
+
+    // Invalidate: a tree edge x -> y that has no parallel arc of the same
+    // weight left cuts off y's whole subtree.
+    const int ends[2][2] = {{u, v}, {v, u}};
+    for (const auto& e : ends) {
+        int x = e[0], y = e[1];
+        if (x == y || parent_[y] != x || parentWeight_[y] != w || inAffected_[y]) continue;
+        bool stillLinked = false;
+        for (const Arc& a : adj_[x])
+            if (a.dest == y && a.weight == w) stillLinked = true;
+        if (stillLinked) continue;
+        affected_.push_back(y);
+        inAffected_[y] = true;
+    }
+    if (affected_.empty()) return 0;
+    for (st::size_t i = 0; i < affected_.size(); ++i) {
+        int x = affected_[i];
+        for (const Arc& a : adj_[x]) {
+            if (!inAffected_[a.dest] && parent_[a.dest] == x) {
+                inAffected_[a.dest] = true;
+                affected_.push_back(a.dest);
+            }
+        }
+    }
+    for (int x : affected_) {
+        distance_[x] = LLONG_MAX;
+        parent_[x] = -1;
+        parentWeight_[x] = 0;
+    }
+
+    // Repair: seed each cut-off vertex from its intact neighbours, then let
+    // Dijkstra settle the region (nothing outside it can change).
+    for (int x : affected_)
+        for (const Arc& a : adj_[x])
+            if (!inAffected_[a.dest])
+                offer(a.dest, x, a.weight);
+    propagate();
+
+    int recomputed = static_cast<int>(affected_.size());
+    for (int x : affected_) inAffected_[x] = false;
+    affected_.clear();
+    return recomputed;
+}
+
+ShortestPathTree IncrementalShortestPaths::tree() const {
+    ShortestPathTree t(numVertices());
+    t.distance = distance_;
+    t.parent = parent_;
+    t.weight = parentWeight_;
+    for (int v = 0; v < numVertices(); ++v)
+        if (distance_[v] != LLONG_MAX) t.order.push_back(v);
+    st::sort(t.order.begin(), t.order.end(), [this](int a, int b) {
+        return distance_[a] != distance_[b] ? distance_[a] < distance_[b] : a < b;
+    });
+    return t;
+}
+
+}
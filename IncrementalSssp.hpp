@@ -0,0 +1,77 @@
+#pragma once
+#include "graph.hpp"
+#include "ResultTree.hpp"
+#include "IndexMinHeap.hpp"
+#include <vector>
+
+namespace graph {
+
+/// @brief Single-source shortest paths kept up to date under edge updates.
+/// Owns a copy of an undirected weighted graph plus the distance and parent
+/// of every vertex from a fixed source. Each update repairs only the
+/// vertices whose distance changes (Ramalingam-Reps):
+///  - addEdge / decreaseWeight: the endpoints that got shorter seed a
+///    Dijkstra that stops where distances no longer improve;
+///  - removeEdge: if it was a tree edge, the subtree below it is
+///    invalidated, seeded from its intact neighbours and re-settled.
+/// Every update returns the number of vertices whose distance it recomputed.
+class IncrementalShortestPaths {
+private:
+    struct Arc {
+        int dest;
+        int weight;
+    };
+
+    int                            source_;
+    std::vector<std::vector<Arc>>  adj_;
+    std::vector<long long>         distance_;
+    std::vector<int>               parent_;
+    std::vector<int>               parentWeight_;
+    IndexMinHeap<long long>        heap_;     // keyed by distance_, empty between updates
+    std::vector<int>               affected_;  // scratch for removeEdge
+    std::vector<bool>              inAffected_;
+
+    void checkVertex(int v) const;
+    Arc* findArc(int u, int v, const Arc* skip);
+    bool offer(int from, int to, int weight);
+    int  propagate();
+
+public:
+    /// @brief Copy g and run Dijkstra from source once.
+    /// @throws std::out_of_range if source is not a vertex of g.
+    IncrementalShortestPaths(const Graph& g, int source);
+
+    // the heap points into distance_
+    IncrementalShortestPaths(const IncrementalShortestPaths&) = delete;
+    IncrementalShortestPaths& operator=(const IncrementalShortestPaths&) = delete;
+
+    int numVertices() const { return static_cast<int>(adj_.size()); }
+    int source() const { return source_; }
+
+    /// @brief Distance from the source; LLONG_MAX if unreachable.
+    long long distance(int v) const { return distance_[v]; }
+    /// @brief Shortest-path tree parent; -1 for the source and unreachable vertices.
+    int parent(int v) const { return parent_[v]; }
+    const std::vector<long long>& distances() const { return distance_; }
+
+    /// @brief Current state as a ShortestPathTree (order: reached vertices
+    /// by distance, ties by id), the same form dijkstraTree returns.
+    ShortestPathTree tree() const;
+
+    /// @brief Insert an undirected edge (same checks as Graph::addEdge).
+    /// @return Vertices whose distance was recomputed
+    int addEdge(int u, int v, int weight);
+
+    /// @brief Lower the weight of the first u-v edge.
+    /// @throws std::runtime_error if there is no such edge, std::invalid_argument
+    ///         if newWeight is not positive or exceeds the current weight.
+    /// @return Vertices whose distance was recomputed
+    int decreaseWeight(int u, int v, int newWeight);
+
+    /// @brief Delete the first u-v edge (invalidate-and-repair).
+    /// @throws std::runtime_error if there is no such edge.
+    /// @return Vertices whose distance was recomputed
+    int removeEdge(int u, int v);
+};
+
+}
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <stdexcept>
+#include <vector>
+
+// IndexMinHeap: binary min-heap of vertex ids 0..n-1 keyed by an external
+// array (keys[id]), with a position table so decreaseKey is O(log n)
+// instead of the linear search MinHeap needs.
+// Key: key type (requires operator<)
+template<typename Key>
+class IndexMinHeap {
+    // heap-ordered ids
+    std::vector<int> heap_;
+    // pos_[id]: index of id in heap_, or -1 if not queued
+    std::vector<int> pos_;
+    // keys, owned by the caller and indexed by id
+    const Key* keys_;
+
+    void place(int i, int id) {
+        heap_[i] = id;
+        pos_[id] = i;
+    }
+
+    // siftUp: move the id at index i toward the root
+    void siftUp(int i) {
+        int id = heap_[i];
+        while (i > 0) {
+            int p = (i - 1) / 2;
+            if (!(keys_[id] < keys_[heap_[p]])) break;
+            place(i, heap_[p]);
+            i = p;
+        }
+        place(i, id);
+    }
+
+    // siftDown: move the id at index i toward the leaves
+    void siftDown(int i) {
+        int id = heap_[i];
+        int n = static_cast<int>(heap_.size());
+        while (true) {
+            int l = 2 * i + 1, r = l + 1, best = i;
+            const Key* bestKey = &keys_[id];
+            if (l < n && keys_[heap_[l]] < *bestKey) { best = l; bestKey = &keys_[heap_[l]]; }
+            if (r < n && keys_[heap_[r]] < *bestKey) best = r;
+            if (best == i) break;
+            place(i, heap_[best]);
+            i = best;
+        }
+        place(i, id);
+    }
+
+public:
+    // constructor: ids range over [0, n), keys must outlive the heap
+    IndexMinHeap(int n, const Key* keys) : pos_(n, -1), keys_(keys) {
+        heap_.reserve(n);
+    }
+
+    bool isEmpty() const { return heap_.empty(); }
+    int  size() const { return static_cast<int>(heap_.size()); }
+
+    // contains: true if id is queued (O(1))
+    bool contains(int id) const { return pos_[id] >= 0; }
+
+    // insert: queue id with its current key
+    void insert(int id) {
+        if (contains(id)) throw std::runtime_error("insert: id already queued");
+        heap_.push_back(id);
+        siftUp(static_cast<int>(heap_.size()) - 1);
+    }
+
+    // extractMin: remove and return the id with the smallest key
+    int extractMin() {
+        if (heap_.empty()) throw std::runtime_error("Heap is empty");
+        int top = heap_[0];
+        pos_[top] = -1;
+        int last = heap_.back();
+        heap_.pop_back();
+        if (!heap_.empty()) {
+            place(0, last);
+            siftDown(0);
+        }
+        return top;
+    }
+
+    // decreaseKey: after keys[id] was lowered, restore heap order
+    void decreaseKey(int id) {
+        if (!contains(id)) throw std::runtime_error("decreaseKey: value not found");
+        siftUp(pos_[id]);
+    }
+
+    // push: insert id, or fix its position if it is already queued
+    void push(int id) {
+        if (contains(id)) siftUp(pos_[id]);
+        else insert(id);
+    }
+};
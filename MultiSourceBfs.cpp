@@ -0,0 +1,104 @@
+#include "MultiSourceBfs.hpp"
+#include "CsrGraph.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+
+namespace st = std;
+
+namespace graph {
+
+// Index of the lowest set bit of a non-zero word.
+static inline int lowestBit(st::uint64_t x) {
+#if defined(__GNUC__)
+    return __builtin_ctzll(x);
+#else
+    int b = 0;
+    while (!(x & 1)) { x >>= 1; ++b; }
+    return b;
+#endif
+}
+
+// runBatch: advance `count` BFS instances together, one bit per instance.
+// Words is the number of 64-bit lanes per vertex; the fixed-size inner loops
+// over Words are what the compiler turns into SIMD.
+// @param dist Row-major count x n output, pre-filled with -1
+template<int Words>
+static void runBatch(const CsrGraph& csr, const int* batch, int count, int* dist) {
+    const int n = csr.numVertices;
+    const st::size_t cells = static_cast<st::size_t>(n) * Words;
+    st::vector<st::uint64_t> seen(cells, 0), visit(cells, 0), next(cells, 0);
+
+    for (int i = 0; i < count; ++i) {
+        st::size_t cell = static_cast<st::size_t>(batch[i]) * Words + i / 64;
+        st::uint64_t bit = st::uint64_t(1) << (i % 64);
+        seen[cell]  |= bit;
+        visit[cell] |= bit;
+        dist[static_cast<st::size_t>(i) * n + batch[i]] = 0;
+    }
+
+    bool active = true;
+    for (int level = 1; active; ++level) {
+        active = false;
+
+        // Push the frontier masks of every active vertex to its neighbours.
+        for (int v = 0; v < n; ++v) {
+            const st::uint64_t* vv = &visit[static_cast<st::size_t>(v) * Words];
+            st::uint64_t any = 0;
+            for (int w = 0; w < Words; ++w) any |= vv[w];
+            if (!any) continue;
+            for (int a = csr.offsets[v]; a < csr.offsets[v + 1]; ++a) {
+                st::uint64_t* nu = &next[static_cast<st::size_t>(csr.dests[a]) * Words];
+                for (int w = 0; w < Words; ++w) nu[w] |= vv[w];
+            }
+        }
+
+        // Keep only first-time arrivals and record their hop distance.
+        for (int u = 0; u < n; ++u) {
+            st::uint64_t* nu = &next[static_cast<st::size_t>(u) * Words];
+            st::uint64_t* su = &seen[static_cast<st::size_t>(u) * Words];
+            st::uint64_t any = 0;
+            for (int w = 0; w < Words; ++w) {
+                st::uint64_t fresh = nu[w] & ~su[w];
+                su[w] |= fresh;
+                nu[w]  = fresh;
+                any   |= fresh;
+            }
+            if (!any) continue;
+            active = true;
+            for (int w = 0; w < Words; ++w) {
+                for (st::uint64_t bits = nu[w]; bits; bits &= bits - 1) {
+                    int lane = w * 64 + lowestBit(bits);
+                    dist[static_cast<st::size_t>(lane) * n + u] = level;
+                }
+            }
+        }
+
+        visit.swap(next);
+        st::fill(next.begin(), next.end(), 0);
+    }
+}
+
+st::vector<int> multiSourceBfs(const Graph& g, const st::vector<int>& sources) {
+    const int n = g.numVertices;
+    for (int s : sources)
+        if (s < 0 || s >= n)
+            throw st::out_of_range("multiSourceBfs: source out of range");
+
+    st::vector<int> dist(sources.size() * static_cast<st::size_t>(n), -1);
+    if (sources.empty()) return dist;
+
+    CsrGraph csr(g);
+    const int total = static_cast<int>(sources.size());
+    for (int first = 0; first < total; first += kMsBfsLanes) {
+        int count = st::min(kMsBfsLanes, total - first);
+        int* rows = dist.data() + static_cast<st::size_t>(first) * n;
+        if (count <= 64)
+            runBatch<1>(csr, sources.data() + first, count, rows);
+        else
+            runBatch<kMsBfsLanes / 64>(csr, sources.data() + first, count, rows);
+    }
+    return dist;
+}
+
+}
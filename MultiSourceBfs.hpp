@@ -0,0 +1,22 @@
+#pragma once
+#include "graph.hpp"
+#include <vector>
+
+namespace graph {
+
+/// @brief Number of BFS instances packed into one bit-parallel sweep.
+constexpr int kMsBfsLanes = 256;
+
+/// @brief Multi-source bit-parallel BFS (MS-BFS).
+/// Sources are processed in batches of up to kMsBfsLanes; inside a batch each
+/// vertex carries one bit per source, so a single scan of the adjacency per
+/// level advances every BFS of the batch at once. Batches of at most 64
+/// sources use one 64-bit word per vertex, larger ones four words.
+/// @param g       Graph to traverse (undirected or directed)
+/// @param sources Source ids (0-based); duplicates are allowed
+/// @return Row-major sources.size() x g.numVertices hop distances;
+///         entry [i * n + v] is the hop count from sources[i] to v, or -1
+/// @throws std::out_of_range if a source is out of range.
+std::vector<int> multiSourceBfs(const Graph& g, const std::vector<int>& sources);
+
+}
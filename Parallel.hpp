@@ -0,0 +1,44 @@
+#pragma once
+#include <algorithm>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace graph {
+
+/// @brief Map a user thread count to a worker count: 0 selects
+/// std::thread::hardware_concurrency().
+/// @throws std::invalid_argument if numThreads < 0.
+inline int resolveThreadCount(int numThreads) {
+    if (numThreads < 0)
+        throw std::invalid_argument("negative thread count");
+    if (numThreads == 0)
+        numThreads = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    return numThreads;
+}
+
+/// @brief Run fn(i) for i in [0, count) on up to numThreads threads.
+/// The range is split into contiguous chunks, one per thread; the calling
+/// thread takes the first chunk. fn must not throw.
+template<typename Fn>
+void parallelFor(int count, int numThreads, const Fn& fn) {
+    int workers = std::min(numThreads, count);
+    if (workers <= 1) {
+        for (int i = 0; i < count; ++i) fn(i);
+        return;
+    }
+    auto run = [&](int t) {
+        long long lo = static_cast<long long>(count) * t / workers;
+        long long hi = static_cast<long long>(count) * (t + 1) / workers;
+        for (int i = static_cast<int>(lo); i < hi; ++i) fn(i);
+    };
+    std::vector<std::thread> pool;
+    pool.reserve(workers - 1);
+    for (int t = 1; t < workers; ++t)
+        pool.emplace_back(run, t);
+    run(0);
+    for (std::thread& th : pool)
+        th.join();
+}
+
+}
@@ -44,4 +44,33 @@ bool QForAlg::is_empty() const { return !front; }
 // True if queue reached capacity.
 bool QForAlg::is_full() const { return size == capacity; }
 
-} 
+// Ring buffer of ids with a fixed capacity.
+IntRingQueue::IntRingQueue(int cap)
+    : buffer(nullptr), head(0), size(0), capacity(cap) {
+    if (cap < 0) throw std::invalid_argument("Queue capacity cannot be negative");
+    buffer = new int[cap];
+}
+
+IntRingQueue::~IntRingQueue() {
+    delete[] buffer;
+}
+
+// Write behind the last element, wrapping at capacity.
+void IntRingQueue::enqueue(int id) {
+    if (is_full()) throw std::overflow_error("Queue is full");
+    int tail = head + size;
+    if (tail >= capacity) tail -= capacity;
+    buffer[tail] = id;
+    ++size;
+}
+
+// Read the front element and advance head.
+int IntRingQueue::dequeue() {
+    if (is_empty()) throw std::out_of_range("Queue is empty");
+    int id = buffer[head];
+    if (++head == capacity) head = 0;
+    --size;
+    return id;
+}
+
+}
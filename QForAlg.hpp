@@ -52,4 +52,34 @@ public:
     bool is_full() const;
 };
 
-}
\ No newline at end of file
+/// @brief Fixed-capacity FIFO ring buffer of vertex ids.
+/// Array-backed, so enqueue/dequeue never allocate.
+class IntRingQueue {
+private:
+    int* buffer;
+    int  head;      ///< index of the front element
+    int  size;
+    int  capacity;
+
+public:
+    /// @brief Create a ring with room for cap ids.
+    /// @throws std::invalid_argument if cap < 0.
+    explicit IntRingQueue(int cap);
+
+    /// @brief Free the buffer.
+    ~IntRingQueue();
+
+    IntRingQueue(const IntRingQueue&) = delete;
+    IntRingQueue& operator=(const IntRingQueue&) = delete;
+
+    /// @brief Append id at the back; throws std::overflow_error if full.
+    void enqueue(int id);
+
+    /// @brief Remove and return the front id; throws std::out_of_range if empty.
+    int dequeue();
+
+    bool is_empty() const { return size == 0; }
+    bool is_full() const { return size == capacity; }
+};
+
+}
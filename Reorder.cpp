@@ -0,0 +1,235 @@
+#include "Reorder.hpp"
+#include "Adjacency.hpp"
+#include <algorithm>
+#include <deque>
+#include <queue>
+#include <stdexcept>
+#include <utility>
+
+namespace st = std;
+
+namespace graph {
+
+// ---------------------------------------------------------------------------
+// VertexOrder
+// ---------------------------------------------------------------------------
+
+VertexOrder::VertexOrder(const st::vector<int>& order)
+    : newId(order.size(), -1), oldId(order) {
+    const int n = static_cast<int>(order.size());
+    for (int k = 0; k < n; ++k) {
+        int v = order[k];
+        if (v < 0 || v >= n || newId[v] != -1)
+            throw st::invalid_argument("VertexOrder: not a permutation");
+        newId[v] = k;
+    }
+}
+
+// Parents are ids too, so they are mapped as well as moved.
+static void mapTree(const VertexOrder& o, const ResultTree& in, ResultTree& out) {
+    for (int v = 0; v < in.size(); ++v) {
+        int old = o.oldId[v];
+        out.parent[old] = in.parent[v] < 0 ? -1 : o.oldId[in.parent[v]];
+        out.weight[old] = in.weight[v];
+    }
+    for (int v : in.order)
+        out.order.push_back(o.oldId[v]);
+}
+
+ResultTree VertexOrder::toOriginal(const ResultTree& tree) const {
+    ResultTree out(tree.size(), tree.directed);
+    mapTree(*this, tree, out);
+    return out;
+}
+
+ShortestPathTree VertexOrder::toOriginal(const ShortestPathTree& tree) const {
+    ShortestPathTree out(tree.size());
+    mapTree(*this, tree, out);
+    out.distance = toOriginal(tree.distance);
+    return out;
+}
+
+// ---------------------------------------------------------------------------
+// Orderings (templated over the adapters in Adjacency.hpp)
+// ---------------------------------------------------------------------------
+
+template<typename Adj>
+static st::vector<int> degrees(const Adj& g) {
+    st::vector<int> deg(g.numVertices(), 0);
+    for (int u = 0; u < g.numVertices(); ++u)
+        forEachArc(g, u, [&](int, int) { ++deg[u]; });
+    return deg;
+}
+
+template<typename Adj>
+static VertexOrder rcm(const Adj& g) {
+    const int n = g.numVertices();
+    st::vector<int> deg = degrees(g);
+    st::vector<int> byDegree(n);
+    for (int v = 0; v < n; ++v) byDegree[v] = v;
+    st::stable_sort(byDegree.begin(), byDegree.end(),
+                    [&](int a, int b) { return deg[a] < deg[b]; });
+
+    st::vector<int> order;
+    order.reserve(n);
+    st::vector<bool> visited(n, false);
+    st::vector<int> next;
+    for (int s : byDegree) {
+        if (visited[s]) continue;
+        visited[s] = true;
+        // order doubles as the BFS queue
+        st::size_t head = order.size();
+        order.push_back(s);
+        for (; head < order.size(); ++head) {
+            int u = order[head];
+            next.clear();
+            forEachArc(g, u, [&](int v, int) {
+                if (!visited[v]) {
+                    visited[v] = true;
+                    next.push_back(v);
+                }
+            });
+            st::sort(next.begin(), next.end(), [&](int a, int b) {
+                return deg[a] != deg[b] ? deg[a] < deg[b] : a < b;
+            });
+            order.insert(order.end(), next.begin(), next.end());
+        }
+    }
+    st::reverse(order.begin(), order.end());
+    return VertexOrder(order);
+}
+
+template<typename Adj>
+static VertexOrder byDegreeDescending(const Adj& g) {
+    st::vector<int> deg = degrees(g);
+    st::vector<int> order(g.numVertices());
+    for (int v = 0; v < g.numVertices(); ++v) order[v] = v;
+    st::stable_sort(order.begin(), order.end(),
+                    [&](int a, int b) { return deg[a] > deg[b]; });
+    return VertexOrder(order);
+}
+
+// Neighbours of higher degree than this are not expanded for shared-neighbour
+// scores; a hub would touch most of the graph for little locality gain.
+static const int kGorderHubDegree = 64;
+
+template<typename Adj>
+static VertexOrder gorder(const Adj& g, int window) {
+    if (window < 1)
+        throw st::invalid_argument("gorderOrder: window must be positive");
+    const int n = g.numVertices();
+    st::vector<int> deg = degrees(g);
+    st::vector<int> score(n, 0);
+    st::vector<bool> placed(n, false);
+    // (score, -id): highest score first, then smallest id. Entries go stale
+    // when the score changes; every change pushes the current value.
+    st::priority_queue<st::pair<int, int>> heap;
+
+    auto bump = [&](int v, int delta) {
+        if (placed[v]) return;
+        score[v] += delta;
+        if (score[v] > 0) heap.push({score[v], -v});
+    };
+    // v enters (+1) or leaves (-1) the window
+    auto touch = [&](int v, int delta) {
+        forEachArc(g, v, [&](int x, int) {
+            bump(x, delta);
+            if (deg[x] > kGorderHubDegree) return;
+            forEachArc(g, x, [&](int y, int) {
+                if (y != v) bump(y, delta);
+            });
+        });
+    };
+
+    // restarts (empty heap) take the highest-degree unplaced vertex
+    VertexOrder seeds = byDegreeDescending(g);
+    int nextSeed = 0;
+    st::vector<int> order;
+    order.reserve(n);
+    st::deque<int> recent;
+    while (static_cast<int>(order.size()) < n) {
+        int v = -1;
+        while (!heap.empty()) {
+            st::pair<int, int> top = heap.top();
+            heap.pop();
+            if (!placed[-top.second] && score[-top.second] == top.first) {
+                v = -top.second;
+                break;
+            }
+        }
+        if (v < 0) {
+            while (placed[seeds.oldId[nextSeed]]) ++nextSeed;
+            v = seeds.oldId[nextSeed];
+        }
+        placed[v] = true;
+        order.push_back(v);
+        touch(v, +1);
+        recent.push_back(v);
+        if (static_cast<int>(recent.size()) > window) {
+            touch(recent.front(), -1);
+            recent.pop_front();
+        }
+    }
+    return VertexOrder(order);
+}
+
+VertexOrder reverseCuthillMcKee(const Graph& g)   { return rcm(ListAdjacency{g}); }
+VertexOrder reverseCuthillMcKee(const CsrView& g) { return rcm(CsrAdjacency{g}); }
+VertexOrder degreeOrder(const Graph& g)           { return byDegreeDescending(ListAdjacency{g}); }
+VertexOrder degreeOrder(const CsrView& g)         { return byDegreeDescending(CsrAdjacency{g}); }
+VertexOrder gorderOrder(const Graph& g, int window)   { return gorder(ListAdjacency{g}, window); }
+VertexOrder gorderOrder(const CsrView& g, int window) { return gorder(CsrAdjacency{g}, window); }
+
+// ---------------------------------------------------------------------------
+// Relabelling
+// ---------------------------------------------------------------------------
+
+static void checkOrderSize(const VertexOrder& order, int n) {
+    if (order.size() != n)
+        throw st::invalid_argument("relabel: order size does not match graph");
+}
+
+Graph* relabel(const Graph& g, const VertexOrder& order) {
+    checkOrderSize(order, g.numVertices);
+    Graph* result = new Graph(g.numVertices);
+    st::vector<const Edge*> arcs;
+    try {
+        // new ids in order, so Edge nodes are allocated in the new layout;
+        // arcs are prepended, hence added back to front
+        for (int u = 0; u < g.numVertices; ++u) {
+            arcs.clear();
+            for (const Edge* e = g.adjList[order.oldId[u]]->edges; e; e = e->next)
+                arcs.push_back(e);
+            for (st::size_t i = arcs.size(); i-- > 0;)
+                result->addDirectedEdge(u, order.newId[arcs[i]->dest->data], arcs[i]->weight);
+        }
+    } catch (...) {
+        delete result;
+        throw;
+    }
+    return result;
+}
+
+CsrGraph relabel(const CsrView& csr, const VertexOrder& order) {
+    const int n = csr.numVertices;
+    checkOrderSize(order, n);
+    st::vector<int> offsets(n + 1, 0);
+    for (int u = 0; u < n; ++u)
+        offsets[u + 1] = offsets[u] + csr.degree(order.oldId[u]);
+    st::vector<int> dests(offsets[n]), weights(offsets[n]);
+    st::vector<st::pair<int, int>> list;
+    for (int u = 0; u < n; ++u) {
+        int old = order.oldId[u];
+        list.clear();
+        for (int a = csr.offsets[old]; a < csr.offsets[old + 1]; ++a)
+            list.emplace_back(order.newId[csr.dests[a]], csr.weights[a]);
+        st::sort(list.begin(), list.end());
+        for (st::size_t i = 0; i < list.size(); ++i) {
+            dests[offsets[u] + i] = list[i].first;
+            weights[offsets[u] + i] = list[i].second;
+        }
+    }
+    return CsrGraph(n, st::move(offsets), st::move(dests), st::move(weights));
+}
+
+}
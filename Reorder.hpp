@@ -0,0 +1,64 @@
+#pragma once
+#include "graph.hpp"
+#include "CsrGraph.hpp"
+#include "ResultTree.hpp"
+#include <vector>
+
+namespace graph {
+
+/// @brief A vertex permutation and its inverse.
+/// Algorithms run on the relabelled graph; toOriginal() translates their
+/// results back to the caller's ids.
+struct VertexOrder {
+    std::vector<int> newId;  ///< newId[old vertex] = its id after relabelling
+    std::vector<int> oldId;  ///< oldId[new vertex] = its original id
+
+    /// @brief Permutation from a visiting order (order[k] gets new id k).
+    /// @throws std::invalid_argument if order is not a permutation of [0, n).
+    explicit VertexOrder(const std::vector<int>& order);
+
+    int size() const { return static_cast<int>(oldId.size()); }
+    int toNew(int v) const { return newId[v]; }
+    int toOld(int v) const { return oldId[v]; }
+
+    /// @brief Re-index a per-vertex array from new ids to original ids.
+    /// (Values are copied as-is; use the ResultTree overloads for id-valued arrays.)
+    template<typename T>
+    std::vector<T> toOriginal(const std::vector<T>& byNewId) const {
+        std::vector<T> byOldId(byNewId.size());
+        for (int v = 0; v < size(); ++v)
+            byOldId[oldId[v]] = byNewId[v];
+        return byOldId;
+    }
+
+    /// @brief A tree computed on the relabelled graph, in original ids.
+    ResultTree toOriginal(const ResultTree& tree) const;
+    ShortestPathTree toOriginal(const ShortestPathTree& tree) const;
+};
+
+/// @brief Reverse Cuthill-McKee: BFS from a minimum-degree vertex of each
+/// component, visiting neighbours by increasing degree, then reversed.
+/// Keeps the ids of adjacent vertices close together (low bandwidth).
+VertexOrder reverseCuthillMcKee(const Graph& g);
+VertexOrder reverseCuthillMcKee(const CsrView& g);
+
+/// @brief Vertices by descending degree (ties by id), so hubs share cache lines.
+VertexOrder degreeOrder(const Graph& g);
+VertexOrder degreeOrder(const CsrView& g);
+
+/// @brief Gorder-style greedy order. Each step places the unplaced vertex
+/// with the most links to the last `window` placed vertices. A link is a
+/// direct edge or a shared neighbour; neighbours of degree above 64 are
+/// not expanded. Scores live in a lazily updated max-heap.
+VertexOrder gorderOrder(const Graph& g, int window = 5);
+VertexOrder gorderOrder(const CsrView& g, int window = 5);
+
+/// @brief Copy of g with vertex v renamed order.toNew(v); each adjacency
+/// list keeps its arcs in their original order.
+/// @return New graph owned by the caller
+Graph* relabel(const Graph& g, const VertexOrder& order);
+
+/// @brief CSR copy of csr in new ids, each list sorted by new neighbour id.
+CsrGraph relabel(const CsrView& csr, const VertexOrder& order);
+
+}
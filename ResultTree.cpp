@@ -0,0 +1,9 @@
+#include "ResultTree.hpp"
+
+namespace graph {
+
+template struct BasicResultTree<int>;
+template struct BasicResultTree<NoWeight>;
+template struct BasicShortestPathTree<int>;
+
+}
@@ -0,0 +1,108 @@
+#pragma once
+#include "graph.hpp"
+#include "Weights.hpp"
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace graph {
+
+/// @brief Compact, movable result of a tree-building algorithm.
+/// The tree is stored as a parent array instead of a Graph, so building it
+/// costs a few contiguous arrays rather than one heap node per vertex and
+/// per edge. toGraph() materializes the old Graph form on demand.
+/// W is the edge weight type of the graph the tree was built from; trees over
+/// NoWeight keep `weight` empty.
+template<typename W>
+struct BasicResultTree {
+    using Weight = W;
+
+    std::vector<int> parent;  ///< tree parent of v, -1 for roots and unreached vertices
+    std::vector<W>   weight;  ///< weight of the edge (parent[v], v); 0 when parent[v] == -1 (empty for NoWeight)
+    std::vector<int> order;   ///< vertices in the order they joined the tree
+    bool             directed;  ///< tree edges point parent -> child (bfs, dijkstra)
+
+    /// @brief Empty tree over n vertices (no parents, nothing reached).
+    BasicResultTree(int n, bool isDirected);
+
+    int size() const { return static_cast<int>(parent.size()); }
+
+    /// @brief Number of tree edges.
+    int numEdges() const;
+
+    /// @brief Build the equivalent Graph, adding tree edges in `order`
+    /// (directed edges for bfs/dijkstra trees, undirected otherwise).
+    /// Only for integral W, since Graph stores int weights; NoWeight trees
+    /// get weight-1 edges.
+    /// @return New graph owned by the caller
+    /// @throws std::out_of_range if a weight does not fit in an int
+    Graph* toGraph() const;
+};
+
+/// @brief Shortest-path tree with the distance of every vertex from the source.
+/// Distances are accumulated in DistanceOf<W> (long long for integral W).
+template<typename W>
+struct BasicShortestPathTree : BasicResultTree<W> {
+    using Distance = DistanceOf<W>;
+
+    std::vector<Distance> distance;  ///< WeightTraits<W>::unreachable() (LLONG_MAX for int) if unreachable
+
+    explicit BasicShortestPathTree(int n);
+};
+
+using ResultTree       = BasicResultTree<int>;
+using ShortestPathTree = BasicShortestPathTree<int>;
+
+namespace detail {
+inline int checkedCount(int n) {
+    if (n < 0)
+        throw std::invalid_argument("ResultTree: negative vertex count");
+    return n;
+}
+}
+
+template<typename W>
+BasicResultTree<W>::BasicResultTree(int n, bool isDirected)
+    : parent(detail::checkedCount(n), -1), weight(kHasWeights<W> ? n : 0, W()), directed(isDirected) {
+    order.reserve(n);
+}
+
+template<typename W>
+int BasicResultTree<W>::numEdges() const {
+    int cnt = 0;
+    for (int p : parent)
+        if (p >= 0) ++cnt;
+    return cnt;
+}
+
+template<typename W>
+Graph* BasicResultTree<W>::toGraph() const {
+    static_assert(std::is_integral<W>::value || !kHasWeights<W>,
+                  "toGraph: Graph only stores integral weights");
+    Graph* result = new Graph(size());
+    try {
+        for (int v : order) {
+            int p = parent[v];
+            if (p < 0) continue;
+            int w = 1;
+            if constexpr (kHasWeights<W>) w = WeightTraits<int>::from(weight[v]);
+            if (directed) result->addDirectedEdge(p, v, w);
+            else          result->addEdge(p, v, w);
+        }
+    } catch (...) {
+        delete result;
+        throw;
+    }
+    return result;
+}
+
+template<typename W>
+BasicShortestPathTree<W>::BasicShortestPathTree(int n)
+    : BasicResultTree<W>(n, true), distance(n, WeightTraits<W>::unreachable()) {}
+
+// int weights are compiled once, in ResultTree.cpp
+extern template struct BasicResultTree<int>;
+extern template struct BasicResultTree<NoWeight>;
+extern template struct BasicShortestPathTree<int>;
+
+}
@@ -0,0 +1,38 @@
+#include "SortedLists.hpp"
+#include "Adjacency.hpp"
+#include <algorithm>
+#include <utility>
+
+namespace st = std;
+
+namespace graph {
+
+// One pass over the source: copy each list, sort it, append it.
+template<typename Adj>
+static void collectSorted(const Adj& adj, SortedLists& out) {
+    out.arcOffsets.assign(out.numVertices + 1, 0);
+    st::vector<st::pair<int, int>> list;
+    for (int u = 0; u < out.numVertices; ++u) {
+        list.clear();
+        for (auto e = adj.first(u); !adj.done(u, e); e = adj.next(e))
+            list.emplace_back(adj.dest(e), adj.weight(e));
+        st::sort(list.begin(), list.end());
+        for (const auto& arc : list) {
+            out.dests.push_back(arc.first);
+            out.weights.push_back(arc.second);
+        }
+        out.arcOffsets[u + 1] = static_cast<int>(out.dests.size());
+    }
+}
+
+SortedLists::SortedLists(const Graph& g) : numVertices(g.numVertices) {
+    collectSorted(ListAdjacency{g}, *this);
+}
+
+SortedLists::SortedLists(const CsrView& csr) : numVertices(csr.numVertices) {
+    dests.reserve(csr.numArcs());
+    weights.reserve(csr.numArcs());
+    collectSorted(CsrAdjacency{csr}, *this);
+}
+
+}
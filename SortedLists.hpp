@@ -0,0 +1,36 @@
+#pragma once
+#include "graph.hpp"
+#include "CsrGraph.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace graph {
+
+/// @brief Adjacency lists sorted by (dest, weight) in CSR layout: the
+/// common input of the compressed formats, so they all see the same order.
+struct SortedLists {
+    int              numVertices;
+    std::vector<int> arcOffsets;  ///< start of u's arcs; degree prefix sums
+    std::vector<int> dests;
+    std::vector<int> weights;
+
+    explicit SortedLists(const Graph& g);
+    explicit SortedLists(const CsrView& csr);
+
+    int degree(int u) const { return arcOffsets[u + 1] - arcOffsets[u]; }
+};
+
+/// @brief memoryBytes() of a compressed format: encoded ids, weights and
+/// the per-vertex byte and arc offset tables.
+inline std::size_t encodedMemoryBytes(const std::vector<std::uint8_t>& bytes,
+                                      const std::vector<int>& weights,
+                                      const std::vector<std::size_t>& byteOffsets,
+                                      const std::vector<int>& arcOffsets) {
+    return bytes.size()
+         + weights.size() * sizeof(int)
+         + byteOffsets.size() * sizeof(std::size_t)
+         + arcOffsets.size() * sizeof(int);
+}
+
+}
@@ -0,0 +1,205 @@
+#include "StreamVByte.hpp"
+#include <cstring>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define SVB_HAVE_SIMD_KERNELS 1
+#include <immintrin.h>
+#endif
+
+namespace st = std;
+
+namespace graph {
+
+// Per control byte: total data length and the pshufb mask that spreads the
+// group's bytes into four little-endian 32-bit lanes (0x80 zeroes a byte).
+struct VByteTables {
+    st::uint8_t length[256];
+    alignas(16) st::uint8_t shuffle[256][16];
+
+    VByteTables() {
+        for (int c = 0; c < 256; ++c) {
+            int offset = 0;
+            for (int j = 0; j < 4; ++j) {
+                int len = ((c >> (2 * j)) & 3) + 1;
+                for (int k = 0; k < 4; ++k)
+                    shuffle[c][4 * j + k] = k < len ? static_cast<st::uint8_t>(offset + k) : 0x80;
+                offset += len;
+            }
+            length[c] = static_cast<st::uint8_t>(offset);
+        }
+    }
+};
+
+static const VByteTables& tables() {
+    static const VByteTables t;
+    return t;
+}
+
+static inline int byteLength(st::uint32_t v) {
+    return v < (1u << 8) ? 1 : v < (1u << 16) ? 2 : v < (1u << 24) ? 3 : 4;
+}
+
+st::size_t streamVByteEncodeDelta(const st::uint32_t* in, st::size_t count,
+                                  st::uint8_t* out, st::uint32_t prev) {
+    if (count == 0) return 0;
+    st::uint8_t* control = out;
+    st::uint8_t* data = out + (count + 3) / 4;
+    st::memset(control, 0, (count + 3) / 4);
+    for (st::size_t i = 0; i < count; ++i) {
+        st::uint32_t delta = in[i] - prev;
+        prev = in[i];
+        int len = byteLength(delta);
+        control[i / 4] |= static_cast<st::uint8_t>((len - 1) << (2 * (i % 4)));
+        for (int k = 0; k < len; ++k)
+            *data++ = static_cast<st::uint8_t>(delta >> (8 * k));
+    }
+    return static_cast<st::size_t>(data - out);
+}
+
+// ---------------------------------------------------------------------------
+// Kernels. Each decodes full groups from `group` up to `limit` and returns
+// the data pointer and running value through its arguments; the caller
+// finishes the tail with the scalar loop. If dataEnd is set, a 16-byte load
+// is only issued when it ends at or before dataEnd.
+// ---------------------------------------------------------------------------
+
+#ifdef SVB_HAVE_SIMD_KERNELS
+__attribute__((target("sse4.1")))
+static void decodeGroupsSse(const st::uint8_t* control, const st::uint8_t*& data,
+                            const st::uint8_t* dataEnd, st::size_t& group, st::size_t limit,
+                            st::uint32_t*& out, st::uint32_t& prev) {
+    const VByteTables& t = tables();
+    __m128i carry = _mm_set1_epi32(static_cast<int>(prev));
+    for (; group < limit; ++group) {
+        if (dataEnd && dataEnd - data < 16) break;
+        st::uint8_t c = control[group];
+        __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+        __m128i v = _mm_shuffle_epi8(bytes, _mm_load_si128(reinterpret_cast<const __m128i*>(t.shuffle[c])));
+        v = _mm_add_epi32(v, _mm_slli_si128(v, 4));
+        v = _mm_add_epi32(v, _mm_slli_si128(v, 8));
+        v = _mm_add_epi32(v, carry);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out), v);
+        carry = _mm_shuffle_epi32(v, 0xff);
+        data += t.length[c];
+        out += 4;
+    }
+    prev = static_cast<st::uint32_t>(_mm_cvtsi128_si32(carry));
+}
+
+__attribute__((target("avx2")))
+static void decodeGroupsAvx2(const st::uint8_t* control, const st::uint8_t*& data,
+                             const st::uint8_t* dataEnd, st::size_t& group, st::size_t limit,
+                             st::uint32_t*& out, st::uint32_t& prev) {
+    const VByteTables& t = tables();
+    const __m256i lastLane = _mm256_set1_epi32(3);
+    const __m256i lastAll  = _mm256_set1_epi32(7);
+    __m256i carry = _mm256_set1_epi32(static_cast<int>(prev));
+    for (; group + 2 <= limit; group += 2) {
+        st::uint8_t c0 = control[group], c1 = control[group + 1];
+        const st::uint8_t* second = data + t.length[c0];
+        if (dataEnd && dataEnd - second < 16) break;
+        __m256i bytes = _mm256_inserti128_si256(
+            _mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data))),
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(second)), 1);
+        __m256i mask = _mm256_inserti128_si256(
+            _mm256_castsi128_si256(_mm_load_si128(reinterpret_cast<const __m128i*>(t.shuffle[c0]))),
+            _mm_load_si128(reinterpret_cast<const __m128i*>(t.shuffle[c1])), 1);
+        __m256i v = _mm256_shuffle_epi8(bytes, mask);
+        // prefix sums inside each 128-bit lane, then carry lane 0 into lane 1
+        v = _mm256_add_epi32(v, _mm256_slli_si256(v, 4));
+        v = _mm256_add_epi32(v, _mm256_slli_si256(v, 8));
+        __m256i low = _mm256_permutevar8x32_epi32(v, lastLane);
+        v = _mm256_add_epi32(v, _mm256_blend_epi32(_mm256_setzero_si256(), low, 0xf0));
+        v = _mm256_add_epi32(v, carry);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), v);
+        carry = _mm256_permutevar8x32_epi32(v, lastAll);
+        data = second + t.length[c1];
+        out += 8;
+    }
+    prev = static_cast<st::uint32_t>(_mm256_cvtsi256_si32(carry));
+}
+#endif
+
+bool vbyteKernelSupported(VByteKernel kernel) {
+    switch (kernel) {
+    case VByteKernel::Auto:
+    case VByteKernel::Scalar:
+        return true;
+#ifdef SVB_HAVE_SIMD_KERNELS
+    case VByteKernel::Sse41:
+        return __builtin_cpu_supports("sse4.1");
+    case VByteKernel::Avx2:
+        return __builtin_cpu_supports("avx2");
+#endif
+    default:
+        return false;
+    }
+}
+
+// Best kernel this CPU supports, resolved once.
+static VByteKernel bestKernel() {
+    static const VByteKernel best =
+        vbyteKernelSupported(VByteKernel::Avx2)  ? VByteKernel::Avx2 :
+        vbyteKernelSupported(VByteKernel::Sse41) ? VByteKernel::Sse41 : VByteKernel::Scalar;
+    return best;
+}
+
+// Delta stored in len bytes at data; the 4-byte load needs data + 4 <= dataEnd.
+static inline st::uint32_t readDelta(const st::uint8_t* data, int len, const st::uint8_t* dataEnd) {
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    if (dataEnd - data >= 4) {
+        st::uint32_t word;
+        st::memcpy(&word, data, sizeof(word));
+        return word & (0xffffffffu >> (8 * (4 - len)));
+    }
+#else
+    (void)dataEnd;
+#endif
+    st::uint32_t delta = 0;
+    for (int k = 0; k < len; ++k)
+        delta |= static_cast<st::uint32_t>(data[k]) << (8 * k);
+    return delta;
+}
+
+st::size_t streamVByteDecodeDelta(const st::uint8_t* in, st::size_t count,
+                                  st::uint32_t* out, st::uint32_t prev, VByteKernel kernel) {
+    const VByteTables& t = tables();
+    const st::uint8_t* control = in;
+    const st::uint8_t* data = in + (count + 3) / 4;
+    const st::size_t groups = count / 4;
+    st::size_t group = 0;
+
+    if (kernel == VByteKernel::Auto || !vbyteKernelSupported(kernel))
+        kernel = bestKernel();
+#ifdef SVB_HAVE_SIMD_KERNELS
+    // A group followed by three more full groups (>= 12 bytes) always has
+    // 16 readable bytes, so most groups need no bounds check.
+    st::size_t safe = groups > 3 ? groups - 3 : 0;
+    if (kernel == VByteKernel::Avx2)
+        decodeGroupsAvx2(control, data, nullptr, group, safe, out, prev);
+    if (kernel != VByteKernel::Scalar)
+        decodeGroupsSse(control, data, nullptr, group, safe, out, prev);
+#endif
+
+    // Exact stream end for the remaining groups and the partial tail
+    const st::uint8_t* dataEnd = data;
+    for (st::size_t g = group; g < groups; ++g)
+        dataEnd += t.length[control[g]];
+    for (st::size_t i = groups * 4; i < count; ++i)
+        dataEnd += ((control[i / 4] >> (2 * (i % 4))) & 3) + 1;
+
+#ifdef SVB_HAVE_SIMD_KERNELS
+    if (kernel != VByteKernel::Scalar)
+        decodeGroupsSse(control, data, dataEnd, group, groups, out, prev);
+#endif
+
+    for (st::size_t i = group * 4; i < count; ++i) {
+        int len = ((control[i / 4] >> (2 * (i % 4))) & 3) + 1;
+        prev += readDelta(data, len, dataEnd);
+        data += len;
+        *out++ = prev;
+    }
+    return static_cast<st::size_t>(data - in);
+}
+
+}
@@ -0,0 +1,42 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+namespace graph {
+
+/// @brief Decoder implementations for streamVByteDecodeDelta.
+enum class VByteKernel {
+    Auto,    ///< best kernel the CPU supports
+    Scalar,  ///< portable byte loop
+    Sse41,   ///< one 4-value group per pshufb
+    Avx2     ///< two groups per 256-bit shuffle
+};
+
+/// @brief True if kernel can run on this CPU (Auto and Scalar always can).
+bool vbyteKernelSupported(VByteKernel kernel);
+
+/// @brief Upper bound on the encoded size of count values.
+inline std::size_t streamVByteMaxBytes(std::size_t count) {
+    return (count + 3) / 4 + 4 * count;
+}
+
+/// @brief Stream VByte encoding of the differences in[i] - in[i-1] (in[-1] = prev).
+/// Layout: ceil(count / 4) control bytes, each holding four 2-bit byte
+/// lengths, then the little-endian data bytes of every difference. The
+/// differences wrap modulo 2^32, so sorted input encodes compactly.
+/// @param out Buffer of at least streamVByteMaxBytes(count) bytes
+/// @return    Bytes written
+std::size_t streamVByteEncodeDelta(const std::uint32_t* in, std::size_t count,
+                                   std::uint8_t* out, std::uint32_t prev = 0);
+
+/// @brief Decode count values written by streamVByteEncodeDelta with the same prev.
+/// SIMD kernels shuffle a whole group of four values out of one 16-byte
+/// load and prefix-sum them in registers. Loads never reach past the end
+/// of the encoded stream, so no padding is required.
+/// @param kernel Implementation to use; one the CPU lacks falls back to the best it has
+/// @return       Bytes consumed
+std::size_t streamVByteDecodeDelta(const std::uint8_t* in, std::size_t count,
+                                   std::uint32_t* out, std::uint32_t prev = 0,
+                                   VByteKernel kernel = VByteKernel::Auto);
+
+}
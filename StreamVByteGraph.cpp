@@ -0,0 +1,50 @@
+#include "StreamVByteGraph.hpp"
+#include <algorithm>
+#include <utility>
+
+namespace st = std;
+
+namespace graph {
+
+// Encode each sorted list block by block; offsets and weights are taken
+// over as they are.
+void StreamVByteGraph::build(SortedLists& lists) {
+    byteOffsets_.assign(numVertices_ + 1, 0);
+    st::uint32_t ids[kVByteBlock];
+    for (int u = 0; u < numVertices_; ++u) {
+        byteOffsets_[u] = bytes_.size();
+        const int* dests = lists.dests.data() + lists.arcOffsets[u];
+        st::size_t degree = static_cast<st::size_t>(lists.degree(u));
+        st::uint32_t prev = 0;
+        for (st::size_t first = 0; first < degree; first += kVByteBlock) {
+            st::size_t count = st::min<st::size_t>(kVByteBlock, degree - first);
+            for (st::size_t i = 0; i < count; ++i)
+                ids[i] = static_cast<st::uint32_t>(dests[first + i]);
+            st::size_t at = bytes_.size();
+            bytes_.resize(at + streamVByteMaxBytes(count));
+            bytes_.resize(at + streamVByteEncodeDelta(ids, count, bytes_.data() + at, prev));
+            prev = ids[count - 1];
+        }
+    }
+    byteOffsets_[numVertices_] = bytes_.size();
+    bytes_.shrink_to_fit();
+    arcOffsets_ = st::move(lists.arcOffsets);
+    weights_ = st::move(lists.weights);
+    weights_.shrink_to_fit();
+}
+
+StreamVByteGraph::StreamVByteGraph(const Graph& g) : numVertices_(g.numVertices) {
+    SortedLists lists(g);
+    build(lists);
+}
+
+StreamVByteGraph::StreamVByteGraph(const CsrView& csr) : numVertices_(csr.numVertices) {
+    SortedLists lists(csr);
+    build(lists);
+}
+
+st::size_t StreamVByteGraph::memoryBytes() const {
+    return encodedMemoryBytes(bytes_, weights_, byteOffsets_, arcOffsets_);
+}
+
+}
@@ -0,0 +1,85 @@
+#pragma once
+#include "graph.hpp"
+#include "CsrGraph.hpp"
+#include "SortedLists.hpp"
+#include "StreamVByte.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace graph {
+
+/// @brief Neighbour ids per encoded block (and per decode call).
+constexpr int kVByteBlock = 64;
+
+/// @brief Read-only adjacency whose sorted neighbour lists are stored as
+/// Stream VByte blocks of up to kVByteBlock delta-coded ids. The first
+/// block of a list starts from 0, and each later block continues from the
+/// previous block's last id. Weights are a separate int array in the same
+/// order. Lists are read one block at a time through NeighborBlocks, which
+/// decodes a whole block into a small buffer with the SIMD decoder.
+class StreamVByteGraph {
+public:
+    /// @brief Block-at-a-time cursor over one vertex's neighbours.
+    class NeighborBlocks {
+    private:
+        const std::uint8_t* bytes_;
+        const int*          weights_;
+        int                 remaining_;  ///< ids not yet decoded
+        int                 size_;       ///< ids in the current block
+        std::uint32_t       prev_;
+        std::uint32_t       ids_[kVByteBlock];
+
+    public:
+        NeighborBlocks(const std::uint8_t* bytes, const int* weights, int count)
+            : bytes_(bytes), weights_(weights), remaining_(count), size_(0), prev_(0) {}
+
+        /// @brief Decode the next block.
+        /// @return false once the list is exhausted
+        bool next() {
+            weights_ += size_;
+            if (remaining_ == 0) {
+                size_ = 0;
+                return false;
+            }
+            size_ = remaining_ < kVByteBlock ? remaining_ : kVByteBlock;
+            bytes_ += streamVByteDecodeDelta(bytes_, static_cast<std::size_t>(size_), ids_, prev_);
+            prev_ = ids_[size_ - 1];
+            remaining_ -= size_;
+            return true;
+        }
+
+        int size() const { return size_; }
+        const std::uint32_t* ids() const { return ids_; }
+        const int* weights() const { return weights_; }
+    };
+
+    /// @brief Encode the adjacency lists of g.
+    explicit StreamVByteGraph(const Graph& g);
+    /// @brief Encode CSR arrays, e.g. a MappedGraph view.
+    explicit StreamVByteGraph(const CsrView& csr);
+
+    int numVertices() const { return numVertices_; }
+    int numArcs() const { return arcOffsets_[numVertices_]; }
+    int degree(int u) const { return arcOffsets_[u + 1] - arcOffsets_[u]; }
+
+    /// @brief Block cursor over u's neighbours in ascending id order; call next() first.
+    NeighborBlocks blocks(int u) const {
+        return NeighborBlocks(bytes_.data() + byteOffsets_[u],
+                              weights_.data() + arcOffsets_[u], degree(u));
+    }
+
+    /// @brief Bytes held by the encoded lists, weights and offset tables.
+    std::size_t memoryBytes() const;
+
+private:
+    int                       numVertices_;
+    std::vector<std::size_t>  byteOffsets_;
+    std::vector<int>          arcOffsets_;
+    std::vector<std::uint8_t> bytes_;
+    std::vector<int>          weights_;
+
+    void build(SortedLists& lists);
+};
+
+}
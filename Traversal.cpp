@@ -0,0 +1,189 @@
+#include "Traversal.hpp"
+#include <algorithm>
+#include <climits>
+#include <stdexcept>
+#include <string>
+
+namespace st = std;
+
+namespace graph {
+
+using SearchSide = BidirectionalWorkspace::Side;
+
+// startSide: reset `side` to a search that has reached only `start`.
+static void startSide(SearchSide& side, int start) {
+    side.visited.reset();
+    side.visited.mark(start);
+    side.depth[start]  = 0;
+    side.parent[start] = -1;
+    side.frontier.assign(1, start);
+}
+
+// expandLevel: advance `side` by one full level; returns the best meeting
+// vertex found against `other` (or -1) and its total hop count in `best`.
+static int expandLevel(const Graph& g, SearchSide& side, const SearchSide& other,
+                       st::vector<int>& next, int& best) {
+    int meet = -1;
+    next.clear();
+    for (int u : side.frontier) {
+        for (Edge* e = g.adjList[u]->edges; e; e = e->next) {
+            int v = e->dest->data;
+            if (!side.visited.mark(v)) continue;
+            side.depth[v]  = side.depth[u] + 1;
+            side.parent[v] = u;
+            next.push_back(v);
+            if (other.visited.marked(v) && side.depth[v] + other.depth[v] < best) {
+                best = side.depth[v] + other.depth[v];
+                meet = v;
+            }
+        }
+    }
+    side.frontier.swap(next);
+    return meet;
+}
+
+HopPath bidirectionalBfs(const Graph& g, int source, int target, BidirectionalWorkspace& ws) {
+    int n = g.numVertices;
+    if (source < 0 || source >= n || target < 0 || target >= n)
+        throw st::out_of_range("bidirectionalBfs: vertex out of range");
+    if (ws.size() != n)
+        throw st::invalid_argument("bidirectionalBfs: workspace size does not match graph");
+    if (source == target)
+        return HopPath{0, {source}};
+
+    SearchSide& fwd = ws.forward_;
+    SearchSide& bwd = ws.backward_;
+    startSide(fwd, source);
+    startSide(bwd, target);
+    int best = INT_MAX;
+    int meet = -1;
+    while (!fwd.frontier.empty() && !bwd.frontier.empty()) {
+        // Expanding the smaller frontier keeps the work near min(|F|, |B|).
+        bool forward = fwd.frontier.size() <= bwd.frontier.size();
+        int m = forward ? expandLevel(g, fwd, bwd, ws.next_, best)
+                        : expandLevel(g, bwd, fwd, ws.next_, best);
+        if (m >= 0) {
+            meet = m;
+            break;
+        }
+    }
+    if (meet < 0)
+        return HopPath{-1, {}};
+
+    HopPath result{best, {}};
+    result.path.reserve(best + 1);
+    for (int v = meet; v >= 0; v = fwd.parent[v])
+        result.path.push_back(v);
+    st::reverse(result.path.begin(), result.path.end());
+    for (int v = bwd.parent[meet]; v >= 0; v = bwd.parent[v])
+        result.path.push_back(v);
+    return result;
+}
+
+HopPath bidirectionalBfs(const Graph& g, int source, int target) {
+    BidirectionalWorkspace ws(g.numVertices);
+    return bidirectionalBfs(g, source, target, ws);
+}
+
+// ---------------------------------------------------------------------------
+// Bounded traversals
+// ---------------------------------------------------------------------------
+
+TraversalWorkspace::TraversalWorkspace(int n) : epoch_(1) {
+    if (n < 0)
+        throw st::invalid_argument("TraversalWorkspace: negative size");
+    stamp_.assign(n, 0);
+}
+
+void TraversalWorkspace::reset() {
+    if (++epoch_ == 0) {
+        // Stamps from 2^32 queries ago would look current again.
+        st::fill(stamp_.begin(), stamp_.end(), 0);
+        epoch_ = 1;
+    }
+}
+
+static void checkBoundedArgs(const Graph& g, int source, const TraversalWorkspace& ws,
+                             const char* who) {
+    if (source < 0 || source >= g.numVertices)
+        throw st::out_of_range(st::string(who) + ": source out of range");
+    if (ws.size() != g.numVertices)
+        throw st::invalid_argument(st::string(who) + ": workspace size does not match graph");
+}
+
+st::vector<int> boundedBfs(const Graph& g, int source, const TraversalLimits& limits,
+                           TraversalWorkspace& ws) {
+    checkBoundedArgs(g, source, ws, "boundedBfs");
+    const st::size_t budget = limits.maxVisited < 0 ? st::size_t(-1)
+                                                    : static_cast<st::size_t>(limits.maxVisited);
+    st::vector<int> order;
+    if (budget == 0) return order;
+
+    ws.reset();
+    ws.mark(source);
+    order.push_back(source);
+
+    // `order` doubles as the queue; [head, levelEnd) is the current level.
+    st::size_t head = 0;
+    for (int depth = 0; head < order.size(); ++depth) {
+        if (limits.maxDepth >= 0 && depth >= limits.maxDepth) break;
+        st::size_t levelEnd = order.size();
+        for (; head < levelEnd; ++head) {
+            for (Edge* e = g.adjList[order[head]]->edges; e; e = e->next) {
+                int v = e->dest->data;
+                if (!ws.mark(v)) continue;
+                order.push_back(v);
+                if (order.size() >= budget) return order;
+            }
+        }
+    }
+    return order;
+}
+
+st::vector<int> boundedBfs(const Graph& g, int source, const TraversalLimits& limits) {
+    TraversalWorkspace ws(g.numVertices);
+    return boundedBfs(g, source, limits, ws);
+}
+
+st::vector<int> boundedDfs(const Graph& g, int source, const TraversalLimits& limits,
+                           TraversalWorkspace& ws) {
+    checkBoundedArgs(g, source, ws, "boundedDfs");
+    const st::size_t budget = limits.maxVisited < 0 ? st::size_t(-1)
+                                                    : static_cast<st::size_t>(limits.maxVisited);
+    st::vector<int> order;
+    if (budget == 0) return order;
+
+    ws.reset();
+    ws.mark(source);
+    order.push_back(source);
+    if (order.size() >= budget) return order;
+
+    // Explicit stack of edge cursors; its height is the current tree depth.
+    st::vector<Edge*> stack;
+    if (limits.maxDepth != 0)
+        stack.push_back(g.adjList[source]->edges);
+    while (!stack.empty()) {
+        Edge*& cursor = stack.back();
+        if (!cursor) {
+            stack.pop_back();
+            continue;
+        }
+        Edge* e = cursor;
+        cursor = cursor->next;
+        int v = e->dest->data;
+        if (!ws.mark(v)) continue;
+        order.push_back(v);
+        if (order.size() >= budget) break;
+        int depth = static_cast<int>(stack.size());
+        if (limits.maxDepth < 0 || depth < limits.maxDepth)
+            stack.push_back(e->dest->edges);
+    }
+    return order;
+}
+
+st::vector<int> boundedDfs(const Graph& g, int source, const TraversalLimits& limits) {
+    TraversalWorkspace ws(g.numVertices);
+    return boundedDfs(g, source, limits, ws);
+}
+
+}
@@ -0,0 +1,115 @@
+#pragma once
+#include "graph.hpp"
+#include <vector>
+
+namespace graph {
+
+/// @brief Result of an unweighted s-t query.
+struct HopPath {
+    int              hops;  ///< number of edges on the path, -1 if unreachable
+    std::vector<int> path;  ///< vertex ids from source to target, empty if unreachable
+};
+
+/// @brief Early-exit limits for boundedBfs / boundedDfs; negative means unlimited.
+struct TraversalLimits {
+    int maxDepth   = -1;  ///< deepest hop level (BFS) or tree depth (DFS) to reach
+    int maxVisited = -1;  ///< maximum number of vertices returned, source included
+};
+
+/// @brief Reusable visited-set for bounded traversals.
+/// Marks are epoch stamps, so starting a new query is O(1) instead of
+/// clearing n flags; keep one per thread and pass it to every query.
+class TraversalWorkspace {
+private:
+    std::vector<unsigned> stamp_;
+    unsigned              epoch_;
+
+public:
+    /// @brief Workspace for graphs with n vertices.
+    explicit TraversalWorkspace(int n);
+
+    int size() const { return static_cast<int>(stamp_.size()); }
+
+    /// @brief Forget all marks (O(1) except on epoch wrap-around).
+    void reset();
+
+    /// @brief Mark v; returns false if it was already marked in this epoch.
+    bool mark(int v) {
+        if (stamp_[v] == epoch_) return false;
+        stamp_[v] = epoch_;
+        return true;
+    }
+
+    bool marked(int v) const { return stamp_[v] == epoch_; }
+};
+
+/// @brief Reusable state for bidirectionalBfs: per direction, an
+/// epoch-stamped visited set plus depth/parent arrays that are only read
+/// where the vertex is marked, so a query never touches all n entries.
+/// Keep one per thread and pass it to every query.
+class BidirectionalWorkspace {
+public:
+    /// @brief Search state of one direction.
+    struct Side {
+        TraversalWorkspace visited;
+        std::vector<int>   depth;     ///< valid where visited.marked(v)
+        std::vector<int>   parent;    ///< valid where visited.marked(v); -1 at the start
+        std::vector<int>   frontier;
+
+        explicit Side(int n) : visited(n), depth(n), parent(n) {}
+    };
+
+private:
+    Side             forward_;
+    Side             backward_;
+    std::vector<int> next_;  // scratch for the level being built
+
+    friend HopPath bidirectionalBfs(const Graph& g, int source, int target,
+                                    BidirectionalWorkspace& ws);
+
+public:
+    /// @brief Workspace for graphs with n vertices.
+    explicit BidirectionalWorkspace(int n) : forward_(n), backward_(n) {}
+
+    int size() const { return forward_.visited.size(); }
+};
+
+/// @brief Bidirectional BFS for a single s-t hop query.
+/// Alternately expands one full level of the smaller frontier (forward from
+/// source, backward from target) and stops at the level where they meet,
+/// so no BFS tree Graph is built and the far side of the graph is not visited.
+/// With a workspace the cost is proportional to the vertices and edges
+/// touched, not to n. The backward search follows out-edges, so g must be
+/// undirected.
+/// @throws std::out_of_range if source or target is out of range.
+/// @throws std::invalid_argument if ws.size() != g.numVertices.
+HopPath bidirectionalBfs(const Graph& g, int source, int target, BidirectionalWorkspace& ws);
+
+/// @brief bidirectionalBfs with a temporary workspace (costs O(n) allocations).
+HopPath bidirectionalBfs(const Graph& g, int source, int target);
+
+/// @brief BFS from source that stops at limits.maxDepth hops or after
+/// limits.maxVisited vertices, whichever comes first.
+/// Work is proportional to the vertices and edges touched, not to the graph.
+/// @return Visited vertex ids in BFS order (source first)
+/// @throws std::out_of_range if source is out of range.
+/// @throws std::invalid_argument if ws.size() != g.numVertices.
+std::vector<int> boundedBfs(const Graph& g, int source, const TraversalLimits& limits,
+                            TraversalWorkspace& ws);
+
+/// @brief boundedBfs with a temporary workspace (costs one O(n) allocation).
+std::vector<int> boundedBfs(const Graph& g, int source, const TraversalLimits& limits);
+
+/// @brief Iterative DFS from source with the same limits as boundedBfs.
+/// maxDepth bounds the depth in the DFS tree, so a vertex first reached on a
+/// long branch is not re-expanded from a shorter one.
+/// @return Visited vertex ids in preorder (same order as dfs visits them)
+/// @throws std::out_of_range if source is out of range.
+/// @throws std::invalid_argument if ws.size() != g.numVertices.
+std::vector<int> boundedDfs(const Graph& g, int source, const TraversalLimits& limits,
+                            TraversalWorkspace& ws);
+
+/// @brief boundedDfs with a temporary workspace (costs one O(n) allocation).
+std::vector<int> boundedDfs(const Graph& g, int source, const TraversalLimits& limits);
+
+}
@@ -0,0 +1,212 @@
+#include "TreeAnalytics.hpp"
+#include <algorithm>
+#include <climits>
+#include <stdexcept>
+
+namespace st = std;
+
+namespace graph {
+
+TreeStats analyzeTree(const Graph& tree, int root) {
+    const int n = tree.numVertices;
+    if (root < 0 || root >= n)
+        throw st::out_of_range("analyzeTree: root out of range");
+
+    TreeStats s;
+    s.root = root;
+    s.parent.assign(n, -1);
+    s.depth.assign(n, -1);
+    s.distance.assign(n, 0);
+    s.subtreeSize.assign(n, 0);
+    s.order.reserve(n);
+
+    // Top-down: BFS order, so every parent precedes its children.
+    s.depth[root] = 0;
+    s.order.push_back(root);
+    for (st::size_t head = 0; head < s.order.size(); ++head) {
+        int u = s.order[head];
+        bool parentArcSkipped = false;
+        for (Edge* e = tree.adjList[u]->edges; e; e = e->next) {
+            int w = e->dest->data;
+            if (w == s.parent[u] && !parentArcSkipped) {
+                parentArcSkipped = true;
+                continue;
+            }
+            if (s.depth[w] >= 0)
+                throw st::invalid_argument("analyzeTree: graph is not a tree");
+            s.parent[w]   = u;
+            s.depth[w]    = s.depth[u] + 1;
+            s.distance[w] = s.distance[u] + e->weight;
+            s.order.push_back(w);
+        }
+    }
+
+    // Bottom-up: fold each vertex into its parent. down/downWeight hold the
+    // longest downward path seen so far; joining two branches at the parent
+    // gives the diameter candidates.
+    st::vector<int>       down(n, 0);
+    st::vector<long long> downWeight(n, 0);
+    s.height = 0;
+    s.diameter = 0;
+    s.weightedDiameter = 0;
+    for (st::size_t i = s.order.size(); i-- > 0;) {
+        int v = s.order[i];
+        s.subtreeSize[v] += 1;
+        s.height = st::max(s.height, s.depth[v]);
+        int p = s.parent[v];
+        if (p < 0) continue;
+        long long w = s.distance[v] - s.distance[p];
+        s.subtreeSize[p] += s.subtreeSize[v];
+        s.diameter = st::max(s.diameter, down[p] + 1 + down[v]);
+        s.weightedDiameter = st::max(s.weightedDiameter, downWeight[p] + w + downWeight[v]);
+        down[p] = st::max(down[p], down[v] + 1);
+        downWeight[p] = st::max(downWeight[p], downWeight[v] + w);
+    }
+    return s;
+}
+
+// ---------------------------------------------------------------------------
+// TreePathQuery
+// ---------------------------------------------------------------------------
+
+TreePathQuery::TreePathQuery(const Graph& tree, int root)
+    : n_(tree.numVertices), levels_(1) {
+    if (root != -1 && (root < 0 || root >= n_))
+        throw st::out_of_range("TreePathQuery: root out of range");
+    while ((1 << levels_) < n_) ++levels_;
+
+    // Symmetric adjacency (CSR) so directed trees can be walked from any root.
+    st::vector<int> offsets(n_ + 1, 0), indegree(n_, 0);
+    for (int u = 0; u < n_; ++u)
+        for (Edge* e = tree.adjList[u]->edges; e; e = e->next) {
+            ++offsets[u + 1];
+            ++offsets[e->dest->data + 1];
+            ++indegree[e->dest->data];
+        }
+    for (int u = 0; u < n_; ++u) offsets[u + 1] += offsets[u];
+    st::vector<int> fill(offsets.begin(), offsets.end() - 1);
+    st::vector<int> nbr(offsets[n_]), wt(offsets[n_]);
+    for (int u = 0; u < n_; ++u)
+        for (Edge* e = tree.adjList[u]->edges; e; e = e->next) {
+            int v = e->dest->data;
+            nbr[fill[u]] = v; wt[fill[u]++] = e->weight;
+            nbr[fill[v]] = u; wt[fill[v]++] = e->weight;
+        }
+
+    up_.assign(static_cast<st::size_t>(levels_) * n_, 0);
+    maxUp_.assign(static_cast<st::size_t>(levels_) * n_, INT_MIN);
+    depth_.assign(n_, -1);
+    treeId_.assign(n_, -1);
+    dist_.assign(n_, 0);
+
+    // BFS each tree from its chosen root; level 0 of the table is the parent.
+    st::vector<int> queue;
+    queue.reserve(n_);
+    auto grow = [&](int r) {
+        if (depth_[r] >= 0) return;
+        depth_[r] = 0;
+        treeId_[r] = r;
+        up_[r] = r;
+        queue.assign(1, r);
+        for (st::size_t head = 0; head < queue.size(); ++head) {
+            int u = queue[head];
+            for (int a = offsets[u]; a < offsets[u + 1]; ++a) {
+                int v = nbr[a];
+                if (depth_[v] >= 0) continue;
+                depth_[v]  = depth_[u] + 1;
+                treeId_[v] = r;
+                dist_[v]   = dist_[u] + wt[a];
+                up_[v]     = u;
+                maxUp_[v]  = wt[a];
+                queue.push_back(v);
+            }
+        }
+    };
+    if (root >= 0) grow(root);
+    for (int v = 0; v < n_; ++v)
+        if (indegree[v] == 0) grow(v);
+    for (int v = 0; v < n_; ++v)
+        grow(v);
+
+    for (int k = 1; k < levels_; ++k) {
+        const int* prevUp  = &up_[static_cast<st::size_t>(k - 1) * n_];
+        const int* prevMax = &maxUp_[static_cast<st::size_t>(k - 1) * n_];
+        int* curUp  = &up_[static_cast<st::size_t>(k) * n_];
+        int* curMax = &maxUp_[static_cast<st::size_t>(k) * n_];
+        for (int v = 0; v < n_; ++v) {
+            int mid = prevUp[v];
+            curUp[v]  = prevUp[mid];
+            curMax[v] = st::max(prevMax[v], prevMax[mid]);
+        }
+    }
+}
+
+void TreePathQuery::checkVertex(int v) const {
+    if (v < 0 || v >= n_)
+        throw st::out_of_range("TreePathQuery: vertex out of range");
+}
+
+bool TreePathQuery::connected(int u, int v) const {
+    checkVertex(u);
+    checkVertex(v);
+    return treeId_[u] == treeId_[v];
+}
+
+int TreePathQuery::depth(int v) const {
+    checkVertex(v);
+    return depth_[v];
+}
+
+int TreePathQuery::climb(int u, int v, int& maxEdge) const {
+    maxEdge = INT_MIN;
+    if (depth_[u] < depth_[v]) st::swap(u, v);
+    int diff = depth_[u] - depth_[v];
+    for (int k = 0; diff; ++k, diff >>= 1) {
+        if (!(diff & 1)) continue;
+        st::size_t at = static_cast<st::size_t>(k) * n_ + u;
+        maxEdge = st::max(maxEdge, maxUp_[at]);
+        u = up_[at];
+    }
+    if (u == v) return u;
+    for (int k = levels_ - 1; k >= 0; --k) {
+        st::size_t au = static_cast<st::size_t>(k) * n_ + u;
+        st::size_t av = static_cast<st::size_t>(k) * n_ + v;
+        if (up_[au] != up_[av]) {
+            maxEdge = st::max(maxEdge, st::max(maxUp_[au], maxUp_[av]));
+            u = up_[au];
+            v = up_[av];
+        }
+    }
+    maxEdge = st::max(maxEdge, st::max(maxUp_[u], maxUp_[v]));
+    return up_[u];
+}
+
+int TreePathQuery::lca(int u, int v) const {
+    if (!connected(u, v)) return -1;
+    int ignored;
+    return climb(u, v, ignored);
+}
+
+long long TreePathQuery::pathLength(int u, int v) const {
+    int a = lca(u, v);
+    if (a < 0)
+        throw st::invalid_argument("TreePathQuery: vertices are in different trees");
+    return dist_[u] + dist_[v] - 2 * dist_[a];
+}
+
+int TreePathQuery::pathHops(int u, int v) const {
+    int a = lca(u, v);
+    if (a < 0)
+        throw st::invalid_argument("TreePathQuery: vertices are in different trees");
+    return depth_[u] + depth_[v] - 2 * depth_[a];
+}
+
+int TreePathQuery::maxEdge(int u, int v) const {
+    if (!connected(u, v))
+        throw st::invalid_argument("TreePathQuery: vertices are in different trees");
+    int best;
+    climb(u, v, best);
+    return best;
+}
+
+}
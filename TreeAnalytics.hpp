@@ -0,0 +1,84 @@
+#pragma once
+#include "graph.hpp"
+#include <vector>
+
+namespace graph {
+
+/// @brief Per-vertex and global statistics of a rooted result tree.
+/// Vertices not reachable from the root have parent -1, depth -1 and
+/// subtree size 0.
+struct TreeStats {
+    int                    root;
+    std::vector<int>       order;        ///< reached vertices, parents before children
+    std::vector<int>       parent;       ///< -1 for the root
+    std::vector<int>       depth;        ///< edges from the root
+    std::vector<long long> distance;     ///< summed edge weights from the root
+    std::vector<int>       subtreeSize;  ///< vertices in the subtree, itself included
+    int                    height;       ///< max depth
+    int                    diameter;     ///< edges on the longest path in the tree
+    long long              weightedDiameter;  ///< heaviest path in the tree
+};
+
+/// @brief Analyze the tree returned by bfs, dfs, dijkstra, prim or kruskal.
+/// Directed trees (bfs, dijkstra) and undirected ones (dfs, prim, kruskal)
+/// are both accepted. One top-down sweep assigns parents and depths, one
+/// bottom-up sweep over the same order fills subtree sizes and the
+/// diameters; both are iterative, so million-vertex paths are fine.
+/// @param tree Result tree (or forest: only root's tree is analyzed)
+/// @param root Root vertex id
+/// @throws std::out_of_range if root is out of range.
+/// @throws std::invalid_argument if the part reachable from root has a cycle.
+TreeStats analyzeTree(const Graph& tree, int root);
+
+/// @brief LCA, path-length and bottleneck (max edge) queries on a result
+/// tree or forest, answered in O(log n) each via binary lifting.
+/// Arcs are read in both directions, so directed trees (bfs, dijkstra) and
+/// undirected ones (dfs, prim, kruskal) both work. Each tree of the forest is
+/// rooted at the given root if it contains it, otherwise at its first vertex
+/// without incoming arcs, otherwise at its smallest id. The input must be a
+/// forest; preprocessing is O(n log n) time and memory.
+class TreePathQuery {
+private:
+    int                    n_;
+    int                    levels_;
+    std::vector<int>       up_;       ///< up_[k * n + v]: 2^k-th ancestor of v (root maps to itself)
+    std::vector<int>       maxUp_;    ///< max edge weight on that 2^k-step climb
+    std::vector<int>       depth_;
+    std::vector<int>       treeId_;   ///< root of v's tree
+    std::vector<long long> dist_;     ///< weighted distance from the root
+
+    void checkVertex(int v) const;
+    /// Climb u and v to their LCA, returning it and the max edge passed.
+    int climb(int u, int v, int& maxEdge) const;
+
+public:
+    /// @brief Preprocess tree.
+    /// @param root Preferred root of its tree, or -1
+    /// @throws std::out_of_range if root is not -1 and out of range.
+    explicit TreePathQuery(const Graph& tree, int root = -1);
+
+    /// @brief True if u and v lie in the same tree.
+    bool connected(int u, int v) const;
+
+    /// @brief Depth of v (edges from its root).
+    int depth(int v) const;
+
+    /// @brief Lowest common ancestor of u and v, or -1 if they are in different trees.
+    /// @throws std::out_of_range if u or v is out of range.
+    int lca(int u, int v) const;
+
+    /// @brief Summed edge weights on the tree path u..v.
+    /// @throws std::invalid_argument if u and v are in different trees.
+    long long pathLength(int u, int v) const;
+
+    /// @brief Number of edges on the tree path u..v.
+    /// @throws std::invalid_argument if u and v are in different trees.
+    int pathHops(int u, int v) const;
+
+    /// @brief Heaviest edge on the tree path u..v (the MST bottleneck);
+    /// INT_MIN when u == v.
+    /// @throws std::invalid_argument if u and v are in different trees.
+    int maxEdge(int u, int v) const;
+};
+
+}
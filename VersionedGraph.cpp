@@ -0,0 +1,172 @@
+#include "VersionedGraph.hpp"
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+namespace st = std;
+
+namespace graph {
+
+// Memory orders are left at seq_cst: a reader's announcement must be
+// ordered before its load of current_, and a writer's exchange of current_
+// before its scan of the announcements (store-load on both sides).
+
+static int checkedVertices(int n) {
+    if (n < 0)
+        throw st::invalid_argument("VersionedGraph: negative vertex count");
+    return n;
+}
+
+static int checkedReaders(int maxReaders) {
+    if (maxReaders < 1)
+        throw st::invalid_argument("VersionedGraph: maxReaders must be positive");
+    return maxReaders;
+}
+
+VersionedGraph::VersionedGraph(int vertices, int maxReaders)
+    : numVertices_(checkedVertices(vertices)),
+      slots_(new ReaderSlot[checkedReaders(maxReaders)]),
+      numSlots_(maxReaders),
+      epoch_(1),
+      current_(nullptr),
+      master_(vertices),
+      pending_(0),
+      lastNumber_(0) {
+    current_.store(new Version(master_, 0));
+}
+
+VersionedGraph::VersionedGraph(const Graph& g, int maxReaders)
+    : numVertices_(g.numVertices),
+      slots_(new ReaderSlot[checkedReaders(maxReaders)]),
+      numSlots_(maxReaders),
+      epoch_(1),
+      current_(nullptr),
+      master_(g.numVertices),
+      pending_(0),
+      lastNumber_(0) {
+    // addDirectedEdge prepends, so add each list back to front
+    st::vector<const Edge*> arcs;
+    for (int u = 0; u < numVertices_; ++u) {
+        arcs.clear();
+        for (const Edge* e = g.adjList[u]->edges; e; e = e->next)
+            arcs.push_back(e);
+        for (st::size_t i = arcs.size(); i-- > 0;)
+            master_.addDirectedEdge(u, arcs[i]->dest->data, arcs[i]->weight);
+    }
+    current_.store(new Version(master_, 0));
+}
+
+VersionedGraph::~VersionedGraph() {
+    delete current_.load();
+    for (Version* v : retired_)
+        delete v;
+}
+
+void VersionedGraph::addEdge(int u, int v, int weight) {
+    st::lock_guard<st::mutex> lock(writeMutex_);
+    master_.addEdge(u, v, weight);
+    ++pending_;
+}
+
+void VersionedGraph::addDirectedEdge(int from, int to, int weight) {
+    st::lock_guard<st::mutex> lock(writeMutex_);
+    master_.addDirectedEdge(from, to, weight);
+    ++pending_;
+}
+
+void VersionedGraph::addEdges(const st::vector<EdgeTriple>& edges) {
+    st::lock_guard<st::mutex> lock(writeMutex_);
+    master_.addEdges(edges);
+    pending_ += static_cast<int>(edges.size());
+}
+
+void VersionedGraph::removeEdge(int u, int v) {
+    st::lock_guard<st::mutex> lock(writeMutex_);
+    master_.removeEdge(u, v);
+    ++pending_;
+}
+
+int VersionedGraph::pendingChanges() {
+    st::lock_guard<st::mutex> lock(writeMutex_);
+    return pending_;
+}
+
+long long VersionedGraph::publish() {
+    st::lock_guard<st::mutex> lock(writeMutex_);
+    if (pending_ == 0)
+        return lastNumber_;
+
+    Version* next = new Version(master_, lastNumber_ + 1);
+    Version* old = current_.exchange(next);
+    // Readers that announced an epoch <= retiredAt may have loaded old.
+    old->retiredAt = epoch_.fetch_add(1);
+    retired_.push_back(old);
+    pending_ = 0;
+    lastNumber_ = next->number;
+    reclaimLocked();
+    return lastNumber_;
+}
+
+// Free every retired version whose retiredAt is below the oldest epoch a
+// pinned reader announced: those readers loaded current_ after it was replaced.
+void VersionedGraph::reclaimLocked() {
+    st::uint64_t oldest = UINT64_MAX;
+    for (int i = 0; i < numSlots_; ++i) {
+        st::uint64_t e = slots_[i].epoch.load();
+        if (e != 0 && e < oldest) oldest = e;
+    }
+    st::size_t kept = 0;
+    for (Version* v : retired_) {
+        if (v->retiredAt < oldest) delete v;
+        else retired_[kept++] = v;
+    }
+    retired_.resize(kept);
+}
+
+st::size_t VersionedGraph::reclaim() {
+    st::lock_guard<st::mutex> lock(writeMutex_);
+    reclaimLocked();
+    return retired_.size();
+}
+
+VersionedGraph::Snapshot VersionedGraph::pin() {
+    // Start probing at a per-thread slot so concurrent readers rarely collide.
+    int start = static_cast<int>(st::hash<st::thread::id>()(st::this_thread::get_id())
+                                 % static_cast<st::size_t>(numSlots_));
+    for (;;) {
+        for (int k = 0; k < numSlots_; ++k) {
+            int i = (start + k) % numSlots_;
+            st::uint64_t expected = 0;
+            if (slots_[i].epoch.load() == 0
+                && slots_[i].epoch.compare_exchange_strong(expected, epoch_.load()))
+                return Snapshot(this, i, current_.load());
+        }
+        st::this_thread::yield();
+    }
+}
+
+VersionedGraph::Snapshot::Snapshot(Snapshot&& other) noexcept
+    : owner_(other.owner_), slot_(other.slot_), version_(other.version_) {
+    other.owner_ = nullptr;
+}
+
+VersionedGraph::Snapshot& VersionedGraph::Snapshot::operator=(Snapshot&& other) noexcept {
+    if (this != &other) {
+        release();
+        owner_ = other.owner_;
+        slot_ = other.slot_;
+        version_ = other.version_;
+        other.owner_ = nullptr;
+    }
+    return *this;
+}
+
+void VersionedGraph::Snapshot::release() {
+    if (!owner_) return;
+    owner_->slots_[slot_].epoch.store(0);
+    owner_ = nullptr;
+}
+
+}
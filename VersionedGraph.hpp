@@ -0,0 +1,120 @@
+#pragma once
+#include "graph.hpp"
+#include "CsrGraph.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace graph {
+
+/// @brief Read-mostly graph with RCU-style snapshots.
+/// Writers change a private master Graph; publish() freezes it into a new
+/// immutable CSR version and swaps it in with one atomic store. Readers pin
+/// the current version without locking and run the CsrView algorithms on it
+/// while writers go on. A replaced version is freed once no reader that
+/// could have seen it is still pinned (epoch-based reclamation).
+class VersionedGraph {
+private:
+    struct Version {
+        CsrGraph      csr;
+        long long     number;
+        std::uint64_t retiredAt;  ///< global epoch when it was replaced
+
+        Version(const Graph& g, long long n) : csr(g), number(n), retiredAt(0) {}
+    };
+
+    // One reader announcement per cache line; 0 marks a free slot.
+    struct alignas(64) ReaderSlot {
+        std::atomic<std::uint64_t> epoch{0};
+    };
+
+    int                           numVertices_;
+    std::unique_ptr<ReaderSlot[]> slots_;
+    int                           numSlots_;
+    std::atomic<std::uint64_t>    epoch_;
+    std::atomic<Version*>         current_;
+
+    std::mutex            writeMutex_;  // guards everything below
+    Graph                 master_;
+    int                   pending_;
+    long long             lastNumber_;
+    std::vector<Version*> retired_;
+
+    void reclaimLocked();
+
+public:
+    /// @brief Pinned read-only version; releasing it (destructor) lets
+    /// writers reclaim versions it kept alive. Move-only.
+    class Snapshot {
+    private:
+        VersionedGraph* owner_;
+        int             slot_;
+        const Version*  version_;
+
+        friend class VersionedGraph;
+        Snapshot(VersionedGraph* owner, int slot, const Version* v)
+            : owner_(owner), slot_(slot), version_(v) {}
+
+    public:
+        ~Snapshot() { release(); }
+        Snapshot(const Snapshot&) = delete;
+        Snapshot& operator=(const Snapshot&) = delete;
+        Snapshot(Snapshot&& other) noexcept;
+        Snapshot& operator=(Snapshot&& other) noexcept;
+
+        /// @brief CSR arrays of this version; valid until release().
+        CsrView view() const { return version_->csr.view(); }
+        /// @brief Publication number (0 for the initial version).
+        long long version() const { return version_->number; }
+        bool pinned() const { return owner_ != nullptr; }
+
+        /// @brief Unpin early; view() must not be used afterwards.
+        void release();
+    };
+
+    /// @brief Empty graph with version 0 published.
+    /// @param maxReaders Snapshots that may be pinned at once; pin() waits
+    ///                   for a free slot beyond that
+    /// @throws std::invalid_argument if vertices < 0 or maxReaders < 1.
+    explicit VersionedGraph(int vertices, int maxReaders = 64);
+
+    /// @brief Start from a copy of g (arcs in the same list order) as version 0.
+    explicit VersionedGraph(const Graph& g, int maxReaders = 64);
+
+    /// @brief Frees every version; no Snapshot may outlive the graph.
+    ~VersionedGraph();
+
+    VersionedGraph(const VersionedGraph&) = delete;
+    VersionedGraph& operator=(const VersionedGraph&) = delete;
+
+    int numVertices() const { return numVertices_; }
+
+    // Writer side: changes are staged in the master graph (serialized by an
+    // internal mutex) and become visible to readers at the next publish().
+    // Errors are those of the matching Graph member.
+    void addEdge(int u, int v, int weight);
+    void addDirectedEdge(int from, int to, int weight);
+    void addEdges(const std::vector<EdgeTriple>& edges);
+    void removeEdge(int u, int v);
+
+    /// @brief Number of staged changes not yet published.
+    int pendingChanges();
+
+    /// @brief Publish the staged changes as a new version (O(V + E) CSR
+    /// build, done outside any reader's path), then reclaim what it can.
+    /// Does nothing if no change is staged.
+    /// @return Number of the current version
+    long long publish();
+
+    /// @brief Pin the current version (lock-free unless all reader slots are taken).
+    Snapshot pin();
+
+    /// @brief Free replaced versions that no pinned reader can still see.
+    /// @return Replaced versions still waiting for their readers
+    std::size_t reclaim();
+};
+
+}
@@ -0,0 +1,65 @@
+#pragma once
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+
+namespace graph {
+
+/// @brief Compile-time properties of an edge weight type W.
+/// Path lengths are accumulated in Distance, which is wider than any
+/// integral W (long long) so a long path of large weights cannot wrap.
+template<typename W>
+struct WeightTraits {
+    static_assert(std::is_arithmetic<W>::value && !std::is_same<W, bool>::value,
+                  "edge weights must be an integral or floating-point type");
+
+    using Distance = typename std::conditional<std::is_floating_point<W>::value,
+                                               double, long long>::type;
+
+    /// @brief Distance of a vertex the source cannot reach.
+    static constexpr Distance unreachable() {
+        return std::numeric_limits<Distance>::has_infinity
+             ? std::numeric_limits<Distance>::infinity()
+             : std::numeric_limits<Distance>::max();
+    }
+
+    /// @brief Convert a weight of another type, rejecting values W cannot hold.
+    /// @throws std::out_of_range if w does not fit in W
+    template<typename From>
+    static W from(From w) {
+        if (std::is_integral<W>::value) {
+            // integral targets: round trip must be exact and keep the sign
+            W narrowed = static_cast<W>(w);
+            if (static_cast<From>(narrowed) != w || (w < From(0)) != (narrowed < W(0)))
+                throw std::out_of_range("weight does not fit in the weight type");
+            return narrowed;
+        }
+        return static_cast<W>(w);
+    }
+};
+
+/// @brief Weight type of unweighted graphs: an empty tag, so CSR graphs and
+/// result trees over it store no per-arc or per-vertex weights at all.
+struct NoWeight {};
+
+/// @brief Unweighted graphs measure paths in hops.
+template<>
+struct WeightTraits<NoWeight> {
+    using Distance = long long;
+
+    static constexpr Distance unreachable() { return std::numeric_limits<Distance>::max(); }
+
+    /// @brief Weights are dropped on conversion.
+    template<typename From>
+    static NoWeight from(From) { return NoWeight{}; }
+};
+
+/// @brief False for NoWeight: code guarded by it touches no weight arrays.
+template<typename W>
+constexpr bool kHasWeights = !std::is_same<W, NoWeight>::value;
+
+/// @brief Type of path lengths over weights W.
+template<typename W>
+using DistanceOf = typename WeightTraits<W>::Distance;
+
+}
@@ -1,23 +1,34 @@
 
 #pragma once
+#include <cstddef>
 #include <iostream>
 #include <stdexcept>
+#include <vector>
 
 
 namespace graph {
 
 /// Forward-declare Vertex so Edge can use it.
 struct Vertex;
+class EdgeIndex;
 
 /// @brief Graph edge node.
 struct Edge {
     int     weight;
+    bool    pooled;   // lives in a bulk block from addEdges (fits in padding)
     Vertex* src;
     Vertex* dest;
     Edge*   next;
 
     Edge(int w, Vertex* s, Vertex* d, Edge* n = nullptr)
-      : weight(w), src(s), dest(d), next(n) {}
+      : weight(w), pooled(false), src(s), dest(d), next(n) {}
+};
+
+/// @brief One undirected edge for Graph::addEdges.
+struct EdgeTriple {
+    int u;
+    int v;
+    int weight;
 };
 
 /// @brief Graph vertex node.
@@ -38,6 +49,10 @@ struct Vertex {
 class Graph {
 private:
     Vertex* root;   
+    EdgeIndex* edgeIndex;  // optional (u,v) -> Edge* hash, nullptr when disabled
+    std::vector<Edge*> edgeBlocks;  // contiguous Edge arrays owned by addEdges
+
+    bool removeIndexedArc(int u, int v);
 
 public:
     int numVertices;
@@ -50,6 +65,32 @@ public:
     void addEdge(int u, int v, int weight);
     void removeEdge(int u, int v);
 
+    /// @brief Bulk-insert undirected edges. All triples are validated before
+    /// anything changes, then arcs are counted per vertex and written into one
+    /// contiguous block, each vertex's new arcs adjacent in memory, in two
+    /// passes (linear with one thread; with more, each chunk's touched
+    /// vertices are sorted). New arcs precede existing ones, in input order.
+    /// @param numThreads Threads for both passes (each owns a contiguous chunk
+    ///                   of the input and counts only the vertices it touches,
+    ///                   so extra memory stays O(V + count));
+    ///                   0 selects std::thread::hardware_concurrency()
+    /// @throws std::out_of_range / std::invalid_argument as addEdge would.
+    void addEdges(const EdgeTriple* edges, std::size_t count, int numThreads = 1);
+    void addEdges(const std::vector<EdgeTriple>& edges, int numThreads = 1);
+
+    /// @brief Build a hash index over all arcs; from then on addEdge and
+    /// removeEdge keep it current and hasEdge/weight/removeEdge are O(1)
+    /// expected. Results match the unindexed scans: with parallel edges the
+    /// first arc in list order is found and removed.
+    void enableEdgeIndex();
+    void disableEdgeIndex();
+    bool hasEdgeIndex() const { return edgeIndex != nullptr; }
+
+    /// @brief True if the arc u -> v exists (linear scan of u's list without an index).
+    bool hasEdge(int u, int v) const;
+    /// @brief Weight of an arc u -> v; throws std::runtime_error if there is none.
+    int  weight(int u, int v) const;
+
     void print_graph() const;
     void print_graph_visually(Graph* g, Vertex* root);
 